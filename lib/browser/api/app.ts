@@ -58,6 +58,20 @@ Object.defineProperty(app, 'applicationMenu', {
   }
 });
 
+// Structured fields are appended to the message as `key=value` pairs, with
+// string values JSON-encoded so the line stays unambiguous to parse.
+app.log = function (message: string, options: Electron.LogOptions = {}) {
+  const { level = 'info', category = 'app', fields = {} } = options;
+  let text = String(message);
+  for (const [key, value] of Object.entries(fields)) {
+    if (!/^[\w.-]+$/.test(key)) {
+      throw new TypeError(`Invalid log field name: ${key}`);
+    }
+    text += ` ${key}=${typeof value === 'string' ? JSON.stringify(value) : String(value)}`;
+  }
+  app._log(level, String(category), text);
+};
+
 // The native implementation is not provided on non-windows platforms
 app.setAppUserModelId = app.setAppUserModelId || (() => {});
 
@@ -1,9 +1,14 @@
 import { fetchWithSession } from '@electron/internal/browser/api/net-fetch';
 import { addIpcDispatchListeners } from '@electron/internal/browser/ipc-dispatch';
+import { WebContentsPool } from '@electron/internal/browser/web-contents-pool';
 import * as deprecate from '@electron/internal/common/deprecate';
 
 import { net } from 'electron/main';
 
+import * as fs from 'fs';
+import * as path from 'path';
+import { setTimeout } from 'timers/promises';
+
 const { fromPartition, fromPath, Session } = process._linkedBinding('electron_browser_session');
 const { isDisplayMediaSystemPickerAvailable } = process._linkedBinding('electron_browser_desktop_capturer');
 
@@ -39,6 +44,14 @@ Session.prototype._init = function () {
     rerouteExtensionEvent('extension-unloaded');
     rerouteExtensionEvent('extension-ready');
   }
+
+  // Earlier versions stored V8 code caches for preload scripts here, which
+  // nothing reads anymore.
+  if (this.storagePath) {
+    fs.promises.rm(path.join(this.storagePath, 'Preload Code Cache'), { recursive: true, force: true }).catch(() => {
+      // A leftover cache only costs disk space.
+    });
+  }
 };
 
 Session.prototype.fetch = function (input: RequestInfo, init?: RequestInit) {
@@ -57,6 +70,150 @@ Session.prototype.setDisplayMediaRequestHandler = function (handler, opts) {
   }, opts);
 };
 
+const webContentsPools = new WeakMap<Electron.Session, WebContentsPool>();
+
+Session.prototype.setWebContentsPool = function (options) {
+  let pool = webContentsPools.get(this);
+  if (!pool) {
+    pool = new WebContentsPool(this);
+    webContentsPools.set(this, pool);
+  }
+  pool.configure(options);
+};
+
+Session.prototype.takePooledWebContents = function (webPreferences) {
+  return webContentsPools.get(this)?.take(webPreferences) ?? null;
+};
+
+Session.prototype.getWebContentsPoolStats = function () {
+  return webContentsPools.get(this)?.getStats() ?? { size: 0, ready: 0, hits: 0, misses: 0 };
+};
+
+// Runs a clear one step at a time, so that a large clear doesn't keep the
+// disk busy for its whole duration. After a step that took t milliseconds,
+// the next one starts t * (1 - budget) / budget milliseconds later.
+async function clearIncrementally<T> (
+  steps: T[],
+  incremental: Electron.IncrementalClearOptions,
+  clearStep: (step: T) => Promise<void>,
+  getRemaining: (completedSteps: number) => object
+) {
+  const { budget = 0.5, signal, onProgress } = incremental;
+  if (!(budget > 0 && budget <= 1)) {
+    throw new TypeError('budget must be greater than 0 and at most 1');
+  }
+
+  let completedSteps = 0;
+  try {
+    while (completedSteps < steps.length) {
+      signal?.throwIfAborted();
+      const start = performance.now();
+      await clearStep(steps[completedSteps]);
+      completedSteps++;
+      onProgress?.({ completedSteps, totalSteps: steps.length });
+      const elapsed = performance.now() - start;
+      if (completedSteps < steps.length && budget < 1) {
+        await setTimeout(elapsed * (1 - budget) / budget, undefined, { signal });
+      }
+    }
+  } catch (error) {
+    if (!signal?.aborted) throw error;
+    // Let the caller pick up where the clear stopped, at the same pace.
+    const remainingIncremental = { ...incremental };
+    delete remainingIncremental.signal;
+    const abortError = new Error('The clear was aborted') as Error & { remaining?: object };
+    abortError.name = 'AbortError';
+    abortError.remaining = Object.assign(getRemaining(completedSteps), { incremental: remainingIncremental });
+    throw abortError;
+  }
+}
+
+function chunk<T> (items: T[], size: number) {
+  const chunks: T[][] = [];
+  for (let i = 0; i < items.length; i += size) {
+    chunks.push(items.slice(i, i + size));
+  }
+  return chunks;
+}
+
+// Without a list of types, an incremental clear clears each type that can be
+// listed in its own step, followed by a step that clears everything but those
+// types. The native methods take the types to leave out as an extra argument,
+// which the public methods below never pass on.
+type ClearStep<T> = { options: T; excludedTypes?: string[] };
+
+// Set on the `remaining` options of such a clear when it was aborted, to the
+// listed types it already cleared. A symbol keeps it out of the public
+// options, and unlike a non-enumerable property it survives a spread.
+const kClearedTypes = Symbol('clearedTypes');
+
+function withClearedTypes<T extends object> (options: T, clearedTypes: string[]): T {
+  return { ...options, [kClearedTypes]: clearedTypes };
+}
+
+function getClearedTypes (options: object): string[] {
+  return (options as { [kClearedTypes]?: string[] })[kClearedTypes] ?? [];
+}
+
+const kClearDataTypes = ['backgroundFetch', 'cache', 'cookies', 'downloads', 'fileSystems', 'indexedDB', 'localStorage', 'serviceWorkers'];
+
+const clearData: (this: Electron.Session, options?: Electron.ClearDataOptions, excludedDataTypes?: string[]) => Promise<void> = Session.prototype.clearData;
+Session.prototype.clearData = function (options) {
+  if (!options?.incremental) return clearData.call(this, options);
+
+  const { incremental, ...clearOptions } = options;
+  let steps: ClearStep<Electron.ClearDataOptions>[];
+  let getRemaining: (completedSteps: number) => Electron.ClearDataOptions;
+  if (clearOptions.origins) {
+    // Clear a few origins at a time.
+    const { originsPerStep = 10 } = incremental;
+    if (!Number.isInteger(originsPerStep) || originsPerStep <= 0) {
+      return Promise.reject(new TypeError('originsPerStep must be a positive integer'));
+    }
+    const origins = clearOptions.origins;
+    steps = chunk(origins, originsPerStep).map(stepOrigins => ({ options: { ...clearOptions, origins: stepOrigins } }));
+    getRemaining = completedSteps => ({ ...clearOptions, origins: origins.slice(completedSteps * originsPerStep) });
+  } else if (clearOptions.dataTypes) {
+    // Clear one type of data at a time.
+    const dataTypes = clearOptions.dataTypes;
+    steps = dataTypes.map(dataType => ({ options: { ...clearOptions, dataTypes: [dataType] } }));
+    getRemaining = completedSteps => ({ ...clearOptions, dataTypes: dataTypes.slice(completedSteps) });
+  } else {
+    const clearedTypes = getClearedTypes(options);
+    const dataTypes = kClearDataTypes.filter(dataType => !clearedTypes.includes(dataType));
+    steps = dataTypes.map(dataType => ({ options: { ...clearOptions, dataTypes: [dataType] } }));
+    steps.push({ options: clearOptions, excludedTypes: kClearDataTypes });
+    getRemaining = completedSteps => withClearedTypes(clearOptions, [...clearedTypes, ...dataTypes.slice(0, completedSteps)]);
+  }
+
+  return clearIncrementally(steps, incremental, step => clearData.call(this, step.options, step.excludedTypes), getRemaining);
+};
+
+const kClearStorageTypes = ['cookies', 'filesystem', 'indexdb', 'localstorage', 'shadercache', 'serviceworkers', 'cachestorage'];
+
+const clearStorageData: (this: Electron.Session, options?: Electron.ClearStorageDataOptions, excludedStorages?: string[]) => Promise<void> = Session.prototype.clearStorageData;
+Session.prototype.clearStorageData = function (options) {
+  if (!options?.incremental) return clearStorageData.call(this, options);
+
+  // Clear one type of storage at a time.
+  const { incremental, ...clearOptions } = options;
+  let steps: ClearStep<Electron.ClearStorageDataOptions>[];
+  let getRemaining: (completedSteps: number) => Electron.ClearStorageDataOptions;
+  if (clearOptions.storages) {
+    const storages = clearOptions.storages;
+    steps = storages.map(storage => ({ options: { ...clearOptions, storages: [storage] } }));
+    getRemaining = completedSteps => ({ ...clearOptions, storages: storages.slice(completedSteps) });
+  } else {
+    const clearedTypes = getClearedTypes(options);
+    const storages = kClearStorageTypes.filter(storage => !clearedTypes.includes(storage));
+    steps = storages.map(storage => ({ options: { ...clearOptions, storages: [storage] } }));
+    steps.push({ options: clearOptions, excludedTypes: kClearStorageTypes });
+    getRemaining = completedSteps => withClearedTypes(clearOptions, [...clearedTypes, ...storages.slice(0, completedSteps)]);
+  }
+
+  return clearIncrementally(steps, incremental, step => clearStorageData.call(this, step.options, step.excludedTypes), getRemaining);
+};
+
 const getPreloadsDeprecated = deprecate.warnOnce('session.getPreloads', 'session.getPreloadScripts');
 Session.prototype.getPreloads = function () {
   getPreloadsDeprecated();
@@ -1,7 +1,12 @@
+import MessageChannelMain from '@electron/internal/browser/api/message-channel';
 import { MessagePortMain } from '@electron/internal/browser/message-port-main';
+import { kDefaultRingBufferCapacity, RingBufferReader, RingBufferWriter } from '@electron/internal/browser/ring-buffer';
+
+import { app } from 'electron/main';
 
 import { EventEmitter } from 'events';
 import { Socket } from 'net';
+import * as os from 'os';
 import { Duplex, PassThrough } from 'stream';
 
 const { _fork } = process._linkedBinding('electron_browser_utility_process');
@@ -10,6 +15,7 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
   #handle: ElectronInternal.UtilityProcessWrapper | null;
   #stdout: Duplex | null = null;
   #stderr: Duplex | null = null;
+  #pendingRingBuffers: RingBufferReader[] = [];
   constructor (modulePath: string, args?: string[], options?: Electron.ForkOptions) {
     super();
 
@@ -105,6 +111,9 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
             this.#stderr.removeAllListeners();
             this.#stderr = null;
           }
+          // Nobody can listen for ring buffers that are still waiting once
+          // the process is gone.
+          for (const reader of this.#pendingRingBuffers.splice(0)) reader.close();
         }
         return false;
       } else if (channel === 'stdout' && this.#stdout) {
@@ -113,10 +122,25 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
       } else if (channel === 'stderr' && this.#stderr) {
         new Socket({ fd: args[0], readable: true }).pipe(this.#stderr);
         return true;
+      } else if (channel === 'ring-buffer') {
+        const reader = new RingBufferReader(args[0]);
+        // Ring buffers created by the child before the parent has set up its
+        // listener are kept for it, like process.parentPort does.
+        if (this.listenerCount('ring-buffer') === 0) {
+          this.#pendingRingBuffers.push(reader);
+          return false;
+        }
+        return this.emit('ring-buffer', reader);
       } else {
         return this.emit(channel, ...args);
       }
     };
+    this.on('newListener', (channel: string | symbol) => {
+      if (channel === 'ring-buffer' && this.#pendingRingBuffers.length > 0) {
+        const readers = this.#pendingRingBuffers.splice(0);
+        process.nextTick(() => readers.forEach(reader => this.emit('ring-buffer', reader)));
+      }
+    });
   }
 
   get pid () {
@@ -131,7 +155,7 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
     return this.#stderr;
   }
 
-  postMessage (message: any, transfer?: MessagePortMain[]) {
+  postMessage (message: any, transfer?: (MessagePortMain | ArrayBuffer)[]) {
     if (Array.isArray(transfer)) {
       transfer = transfer.map((o: any) => o instanceof MessagePortMain ? o._internalPort : o);
       return this.#handle?.postMessage(message, transfer);
@@ -139,6 +163,14 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
     return this.#handle?.postMessage(message);
   }
 
+  createRingBuffer (options?: { capacity?: number }) : RingBufferWriter | null {
+    if (this.#handle === null) {
+      return null;
+    }
+    const writer = this.#handle.createRingBuffer(options?.capacity ?? kDefaultRingBufferCapacity);
+    return writer ? new RingBufferWriter(writer) : null;
+  }
+
   kill () : boolean {
     if (this.#handle === null) {
       return false;
@@ -150,3 +182,445 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
 export function fork (modulePath: string, args?: string[], options?: Electron.ForkOptions) {
   return new ForkUtilityProcess(modulePath, args, options);
 }
+
+const kJobPriorities = ['high', 'normal', 'low'];
+
+// Workers that keep exiting before completing a job, e.g. because their entry
+// script throws, are only replaced this many times in a row.
+const kMaxConsecutiveWorkerFailures = 5;
+
+type PoolJob = {
+  message: any;
+  transfer?: (MessagePortMain | ArrayBuffer)[];
+  priority: number;
+  signal?: AbortSignal;
+  onAbort?: () => void;
+  timeout?: number;
+  timer?: NodeJS.Timeout;
+  cancelled?: boolean;
+  resolve: (result: any) => void;
+  reject: (error: Error) => void;
+  queuedAt: number;
+  startedAt?: number;
+  port?: MessagePortMain;
+  worker?: PoolWorker;
+};
+
+type PoolWorker = {
+  child: ForkUtilityProcess;
+  ready: boolean;
+  job: PoolJob | null;
+  // Jobs assigned to this worker, by priority.
+  queues: PoolJob[][];
+  queuedJobs: number;
+  completedJobs: number;
+  startedAt: number;
+};
+
+function checkPositiveInteger (name: string, value: any) {
+  if (value !== undefined && (!Number.isInteger(value) || value <= 0)) {
+    throw new TypeError(`${name} must be a positive integer`);
+  }
+}
+
+class UtilityProcessPool extends EventEmitter implements Electron.UtilityProcessPool {
+  #modulePath: string;
+  #args: string[];
+  #forkOptions: Electron.ForkOptions;
+  #size: number;
+  #maxJobsPerWorker: number;
+  #maxWorkerMemory: number;
+  #maxQueuedJobs: number;
+  #workers = new Set<PoolWorker>();
+  #queuedJobs = 0;
+  #queueFull = false;
+  #closed = false;
+  #createdAt = performance.now();
+  #busyTime = 0;
+  #completedJobs = 0;
+  #failedJobs = 0;
+  #cancelledJobs = 0;
+  #stolenJobs = 0;
+  #recycledWorkers = 0;
+  #consecutiveWorkerFailures = 0;
+  #totalLatency = 0;
+  #totalQueueTime = 0;
+
+  constructor (modulePath: string, args?: string[], options?: Electron.CreatePoolOptions) {
+    super();
+
+    if (!modulePath) {
+      throw new Error('Missing UtilityProcess entry script.');
+    }
+
+    if (args == null) {
+      args = [];
+    } else if (typeof args === 'object' && !Array.isArray(args)) {
+      options = args;
+      args = [];
+    }
+    options = options ?? {};
+
+    checkPositiveInteger('size', options.size);
+    checkPositiveInteger('maxJobsPerWorker', options.maxJobsPerWorker);
+    checkPositiveInteger('maxWorkerMemory', options.maxWorkerMemory);
+    checkPositiveInteger('maxQueuedJobs', options.maxQueuedJobs);
+
+    this.#modulePath = modulePath;
+    this.#args = args;
+    this.#forkOptions = (options.workerOptions ?? {}) as Electron.ForkOptions;
+    this.#size = options.size ?? Math.max(1, os.availableParallelism() - 1);
+    this.#maxJobsPerWorker = options.maxJobsPerWorker ?? Infinity;
+    this.#maxWorkerMemory = options.maxWorkerMemory ?? Infinity;
+    this.#maxQueuedJobs = options.maxQueuedJobs ?? Infinity;
+
+    for (let i = 0; i < this.#size; i++) {
+      this.#spawnWorker();
+    }
+  }
+
+  run (message: any, options?: Electron.RunOptions) : Promise<any> {
+    if (this.#closed) {
+      return Promise.reject(new Error('The pool is closed'));
+    }
+    if (this.#workers.size === 0) {
+      return Promise.reject(new Error('The pool has no workers left'));
+    }
+    const priority = kJobPriorities.indexOf(options?.priority ?? 'normal');
+    if (priority === -1) {
+      return Promise.reject(new TypeError(`priority must be one of: ${kJobPriorities.join(', ')}`));
+    }
+    const timeout = options?.timeout;
+    if (timeout !== undefined && (!Number.isInteger(timeout) || timeout <= 0)) {
+      return Promise.reject(new TypeError('timeout must be a positive integer'));
+    }
+    const signal = options?.signal;
+    if (signal?.aborted) {
+      return Promise.reject(signal.reason);
+    }
+    if (this.#queuedJobs >= this.#maxQueuedJobs) {
+      this.#queueFull = true;
+      return Promise.reject(new Error('The job queue is full'));
+    }
+    return new Promise((resolve, reject) => {
+      const job: PoolJob = {
+        message,
+        transfer: options?.transfer,
+        priority,
+        signal,
+        timeout,
+        resolve,
+        reject,
+        queuedAt: performance.now()
+      };
+      if (signal) {
+        job.onAbort = () => this.#cancelJob(job);
+        signal.addEventListener('abort', job.onAbort, { once: true });
+      }
+      this.#enqueue(this.#leastLoadedWorker(), job);
+    });
+  }
+
+  close () : Promise<void> {
+    this.#closed = true;
+    const error = new Error('The pool was closed');
+    const exits: Promise<void>[] = [];
+    for (const worker of this.#workers) {
+      this.#rejectQueuedJobs(worker, error);
+      exits.push(this.#retireWorker(worker, error));
+    }
+    return Promise.all(exits).then(() => {});
+  }
+
+  getMetrics () : Electron.UtilityProcessPoolMetrics {
+    const now = performance.now();
+    let busyTime = this.#busyTime;
+    let idleWorkers = 0;
+    const workerMetrics: Electron.UtilityProcessPoolWorkerMetrics[] = [];
+    for (const worker of this.#workers) {
+      if (worker.job) {
+        busyTime += now - worker.job.startedAt!;
+      } else if (worker.ready) {
+        idleWorkers++;
+      }
+      const seconds = (now - worker.startedAt) / 1000;
+      workerMetrics.push({
+        pid: worker.child.pid,
+        running: !!worker.job,
+        queuedJobs: worker.queuedJobs,
+        completedJobs: worker.completedJobs,
+        throughput: seconds > 0 ? worker.completedJobs / seconds : 0
+      });
+    }
+    const elapsed = (now - this.#createdAt) * this.#size;
+    return {
+      workers: this.#workers.size,
+      idleWorkers,
+      queuedJobs: this.#queuedJobs,
+      completedJobs: this.#completedJobs,
+      failedJobs: this.#failedJobs,
+      cancelledJobs: this.#cancelledJobs,
+      stolenJobs: this.#stolenJobs,
+      recycledWorkers: this.#recycledWorkers,
+      averageJobLatency: this.#completedJobs ? this.#totalLatency / this.#completedJobs : 0,
+      averageQueueTime: this.#completedJobs ? this.#totalQueueTime / this.#completedJobs : 0,
+      utilization: elapsed > 0 ? Math.min(1, busyTime / elapsed) : 0,
+      workerMetrics
+    };
+  }
+
+  #spawnWorker (queues?: PoolJob[][]) {
+    const worker: PoolWorker = {
+      child: new ForkUtilityProcess(this.#modulePath, this.#args, this.#forkOptions),
+      ready: false,
+      job: null,
+      queues: kJobPriorities.map(() => []),
+      queuedJobs: 0,
+      completedJobs: 0,
+      startedAt: performance.now()
+    };
+    this.#workers.add(worker);
+    // A replacement worker takes over the jobs assigned to the one it
+    // replaces.
+    for (const job of (queues ?? []).flat()) {
+      this.#enqueue(worker, job);
+    }
+    worker.child.once('spawn', () => {
+      worker.ready = true;
+      worker.startedAt = performance.now();
+      this.#runNextJob(worker);
+    });
+    // A fatal V8 error, such as running out of memory, is followed by 'exit'.
+    worker.child.on('error', (type: string, location: string) => {
+      if (worker.job) {
+        this.#failJob(worker, new Error(`The worker hit a ${type} at ${location} while running the job`));
+      }
+    });
+    worker.child.once('exit', (code: number) => {
+      // Workers that the pool retired have already been removed.
+      if (!this.#workers.delete(worker)) return;
+      if (worker.job) {
+        this.#failJob(worker, new Error(`The worker exited with code ${code} while running the job`));
+      }
+      if (worker.completedJobs === 0) {
+        this.#consecutiveWorkerFailures++;
+      }
+      // Don't keep replacing a worker that can't be launched, or whose entry
+      // script keeps failing.
+      if (this.#consecutiveWorkerFailures >= kMaxConsecutiveWorkerFailures) {
+        this.#rejectQueuedJobs(worker, new Error(`The pool's workers exited ${this.#consecutiveWorkerFailures} times in a row without completing a job`));
+      } else if (!this.#closed && worker.ready) {
+        this.#spawnWorker(this.#takeQueuedJobs(worker));
+      } else if (this.#workers.size === 0) {
+        this.#rejectQueuedJobs(worker, new Error('The pool has no workers left'));
+      } else {
+        for (const job of this.#takeQueuedJobs(worker).flat()) {
+          this.#enqueue(this.#leastLoadedWorker(), job);
+        }
+      }
+    });
+  }
+
+  #retireWorker (worker: PoolWorker, error: Error) : Promise<void> {
+    this.#workers.delete(worker);
+    if (worker.job) {
+      this.#failJob(worker, error);
+    }
+    return new Promise((resolve) => {
+      if (worker.child.pid === undefined && worker.ready) {
+        resolve();
+        return;
+      }
+      worker.child.once('exit', () => resolve());
+      if (worker.ready) {
+        worker.child.kill();
+      } else {
+        worker.child.once('spawn', () => worker.child.kill());
+      }
+    });
+  }
+
+  #replaceWorker (worker: PoolWorker) {
+    this.#retireWorker(worker, new Error('The worker was recycled'));
+    if (!this.#closed) {
+      this.#spawnWorker(this.#takeQueuedJobs(worker));
+    }
+  }
+
+  #leastLoadedWorker () : PoolWorker {
+    let best: PoolWorker | undefined;
+    let bestLoad = Infinity;
+    for (const worker of this.#workers) {
+      const load = worker.queuedJobs + (worker.job || !worker.ready ? 1 : 0);
+      if (load < bestLoad) {
+        best = worker;
+        bestLoad = load;
+      }
+    }
+    return best!;
+  }
+
+  #enqueue (worker: PoolWorker, job: PoolJob) {
+    job.worker = worker;
+    worker.queues[job.priority].push(job);
+    worker.queuedJobs++;
+    this.#queuedJobs++;
+    this.#runNextJob(worker);
+  }
+
+  #dequeue (worker: PoolWorker, job: PoolJob) {
+    const queue = worker.queues[job.priority];
+    queue.splice(queue.indexOf(job), 1);
+    worker.queuedJobs--;
+    this.#queuedJobs--;
+    this.#checkDrain();
+  }
+
+  #checkDrain () {
+    if (this.#queueFull && this.#queuedJobs < this.#maxQueuedJobs) {
+      this.#queueFull = false;
+      if (!this.#closed) {
+        this.emit('drain');
+      }
+    }
+  }
+
+  // The caller either enqueues the jobs again, which leaves the number of
+  // queued jobs unchanged, or rejects them with #rejectQueuedJobs.
+  #takeQueuedJobs (worker: PoolWorker) : PoolJob[][] {
+    const queues = worker.queues;
+    this.#queuedJobs -= worker.queuedJobs;
+    worker.queues = kJobPriorities.map(() => []);
+    worker.queuedJobs = 0;
+    return queues;
+  }
+
+  #rejectQueuedJobs (worker: PoolWorker, error: Error) {
+    for (const job of this.#takeQueuedJobs(worker).flat()) {
+      this.#failedJobs++;
+      this.#settleJob(job);
+      job.reject(error);
+    }
+    this.#checkDrain();
+  }
+
+  // Picks the next job for an idle worker: the most urgent job of its own
+  // queue, or else the most urgent job of the busiest other worker's queue.
+  #nextJob (worker: PoolWorker) : PoolJob | undefined {
+    let victim = worker;
+    if (worker.queuedJobs === 0) {
+      for (const other of this.#workers) {
+        if (other.queuedJobs > victim.queuedJobs) {
+          victim = other;
+        }
+      }
+      if (victim === worker) return undefined;
+      this.#stolenJobs++;
+    }
+    const job = victim.queues.find(queue => queue.length > 0)![0];
+    this.#dequeue(victim, job);
+    return job;
+  }
+
+  #runNextJob (worker: PoolWorker) {
+    if (!worker.ready || worker.job) return;
+    const job = this.#nextJob(worker);
+    if (!job) return;
+    // Each job gets its own reply port, so that a worker's replies can't be
+    // mistaken for another job's.
+    const { port1, port2 } = new MessageChannelMain();
+    job.port = port1;
+    job.worker = worker;
+    job.startedAt = performance.now();
+    worker.job = job;
+    port1.once('message', (event) => this.#finishJob(worker, job, event.data));
+    port1.start();
+    if (job.timeout !== undefined) {
+      job.timer = setTimeout(() => this.#timeOutJob(worker, job), job.timeout);
+    }
+    try {
+      worker.child.postMessage(job.message, [port2, ...(job.transfer ?? [])]);
+    } catch (error) {
+      this.#failJob(worker, error as Error);
+      this.#runNextJob(worker);
+    }
+  }
+
+  #finishJob (worker: PoolWorker, job: PoolJob, result: any) {
+    if (worker.job !== job) return;
+    const now = performance.now();
+    worker.job = null;
+    worker.completedJobs++;
+    this.#consecutiveWorkerFailures = 0;
+    clearTimeout(job.timer);
+    job.port!.close();
+    this.#busyTime += now - job.startedAt!;
+    // A cancelled job was already rejected; its worker is only free now.
+    if (!job.cancelled) {
+      this.#completedJobs++;
+      this.#totalLatency += now - job.queuedAt;
+      this.#totalQueueTime += job.startedAt! - job.queuedAt;
+      this.#settleJob(job);
+      job.resolve(result);
+    }
+
+    if (this.#shouldRecycle(worker)) {
+      this.#recycledWorkers++;
+      this.#replaceWorker(worker);
+      return;
+    }
+    this.#runNextJob(worker);
+  }
+
+  #timeOutJob (worker: PoolWorker, job: PoolJob) {
+    if (worker.job !== job) return;
+    this.#failJob(worker, new Error(`The job timed out after ${job.timeout} ms`));
+    // The worker may still be busy with the job, so it can't take another.
+    this.#replaceWorker(worker);
+  }
+
+  #failJob (worker: PoolWorker, error: Error) {
+    const job = worker.job!;
+    worker.job = null;
+    clearTimeout(job.timer);
+    job.port?.close();
+    this.#busyTime += performance.now() - job.startedAt!;
+    if (!job.cancelled) {
+      this.#failedJobs++;
+      this.#settleJob(job);
+      job.reject(error);
+    }
+  }
+
+  #cancelJob (job: PoolJob) {
+    job.cancelled = true;
+    this.#cancelledJobs++;
+    if (job.startedAt === undefined) {
+      this.#dequeue(job.worker!, job);
+    }
+    // A running job can't be interrupted; its reply is dropped.
+    job.reject(job.signal!.reason);
+  }
+
+  #settleJob (job: PoolJob) {
+    if (job.onAbort) {
+      job.signal!.removeEventListener('abort', job.onAbort);
+    }
+  }
+
+  #shouldRecycle (worker: PoolWorker) {
+    if (worker.completedJobs >= this.#maxJobsPerWorker) {
+      return true;
+    }
+    if (this.#maxWorkerMemory !== Infinity) {
+      const metric = app.getAppMetrics().find(metric => metric.pid === worker.child.pid);
+      // workingSetSize is in kilobytes.
+      return !!metric && metric.memory.workingSetSize > this.#maxWorkerMemory;
+    }
+    return false;
+  }
+}
+
+export function createPool (modulePath: string, args?: string[], options?: Electron.CreatePoolOptions) {
+  return new UtilityProcessPool(modulePath, args, options);
+}
@@ -211,9 +211,7 @@ function parsePageSize (pageSize: string | ElectronInternal.PageSize) {
 }
 
 // Translate the options of printToPDF.
-
-let pendingPromise: Promise<any> | undefined;
-WebContents.prototype.printToPDF = async function (options) {
+function parsePrintToPDFOptions (options: Electron.PrintToPDFOptions) {
   const margins = checkType(options.margins ?? {}, 'object', 'margins');
   const pageSize = parsePageSize(options.pageSize ?? 'letter');
 
@@ -244,16 +242,41 @@ WebContents.prototype.printToPDF = async function (options) {
     ...pageSize
   };
 
-  if (this._printToPDF) {
-    if (pendingPromise) {
-      pendingPromise = pendingPromise.then(() => this._printToPDF(printSettings));
-    } else {
-      pendingPromise = this._printToPDF(printSettings);
-    }
-    return pendingPromise;
-  } else {
+  return printSettings;
+}
+
+// PDF jobs on the same WebContents run one at a time, but jobs on different
+// WebContents can run concurrently.
+const pendingPDFJobs = new WeakMap<Electron.WebContents, Promise<unknown>>();
+function queuePDFJob<T> (webContents: Electron.WebContents, job: () => Promise<T>): Promise<T> {
+  const pending = pendingPDFJobs.get(webContents);
+  // A failed job must not keep the ones queued after it from running.
+  const result = pending ? pending.then(job, job) : job();
+  const settled = result.catch(() => {});
+  pendingPDFJobs.set(webContents, settled);
+  settled.then(() => {
+    if (pendingPDFJobs.get(webContents) === settled) pendingPDFJobs.delete(webContents);
+  });
+  return result;
+}
+
+WebContents.prototype.printToPDF = async function (options) {
+  const printSettings = parsePrintToPDFOptions(options);
+  if (!this._printToPDF) {
+    throw new Error('Printing feature is disabled');
+  }
+  return queuePDFJob(this, () => this._printToPDF(printSettings));
+};
+
+WebContents.prototype.printToPDFFile = async function (filePath, options = {}) {
+  if (typeof filePath !== 'string' || !path.isAbsolute(filePath)) {
+    throw new TypeError('filePath must be an absolute path');
+  }
+  const printSettings = parsePrintToPDFOptions(options);
+  if (!this._printToPDFFile) {
     throw new Error('Printing feature is disabled');
   }
+  return queuePDFJob(this, () => this._printToPDFFile(filePath, printSettings));
 };
 
 // TODO(codebytere): deduplicate argument sanitization by moving rest of
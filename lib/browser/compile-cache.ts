@@ -0,0 +1,56 @@
+import { app } from 'electron/main';
+
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as path from 'path';
+
+const Module = require('module') as typeof import('module');
+
+const kCacheDirName = 'Compile Cache';
+
+// Each build of the app gets its own cache directory. Node validates every
+// cached entry against the hash of the module source anyway, so the key only
+// exists to keep caches from different app builds from piling up on disk.
+const getCacheKey = (archive: NodeJS.AsarArchive | null) => {
+  const integrity = archive?.getHeaderIntegrity();
+  return crypto.createHash('sha256')
+    .update(process.versions.electron)
+    .update('\0')
+    .update(integrity ? integrity.hash : app.getVersion())
+    .digest('hex')
+    .slice(0, 16);
+};
+
+const removeStaleCaches = async (cacheRoot: string, currentKey: string) => {
+  const entries = await fs.promises.readdir(cacheRoot);
+  await Promise.all(entries
+    .filter(entry => entry !== currentKey)
+    .map(entry => fs.promises.rm(path.join(cacheRoot, entry), { recursive: true, force: true })));
+};
+
+/**
+ * Enables Node's on-disk V8 compile cache for the app's main process code,
+ * so modules loaded on subsequent launches deserialize their code cache
+ * instead of being compiled from source.
+ *
+ * This has to run before the main script is compiled, so the cache can't
+ * follow a userData path the script sets itself with app.setPath(). It uses
+ * the path in effect at this point, which accounts for the package.json name
+ * and the --user-data-dir switch.
+ */
+export function enableAppCompileCache (archive: NodeJS.AsarArchive | null) {
+  const cacheRoot = path.join(app.getPath('userData'), kCacheDirName);
+  const key = getCacheKey(archive);
+
+  const { status, message } = Module.enableCompileCache(path.join(cacheRoot, key));
+  if (status === Module.constants.compileCacheStatus.FAILED) {
+    console.warn(`Failed to enable the compile cache: ${message}`);
+    return;
+  }
+
+  app.once('ready', () => {
+    removeStaleCaches(cacheRoot, key).catch(() => {
+      // A leftover cache only costs disk space.
+    });
+  });
+}
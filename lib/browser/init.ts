@@ -1,3 +1,4 @@
+import type * as compileCacheModule from '@electron/internal/browser/compile-cache';
 import type * as defaultMenuModule from '@electron/internal/browser/default-menu';
 
 import { EventEmitter } from 'events';
@@ -140,6 +141,13 @@ if (packageJson.v8Flags != null) {
 
 app.setAppPath(packagePath);
 
+// Enable the main process compile cache if the app opted in, deliberately lazy
+// load so that apps that do not use this feature do not pay the price
+if (packageJson.compileCache === true) {
+  const { enableAppCompileCache } = require('@electron/internal/browser/compile-cache') as typeof compileCacheModule;
+  enableAppCompileCache(getOrCreateArchive?.(packagePath) ?? null);
+}
+
 // Load the chrome devtools support.
 require('@electron/internal/browser/devtools');
 
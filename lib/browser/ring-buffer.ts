@@ -0,0 +1,56 @@
+import { EventEmitter } from 'events';
+
+export const kDefaultRingBufferCapacity = 1024 * 1024;
+
+export class RingBufferWriter extends EventEmitter implements Electron.RingBufferWriter {
+  #writer: any;
+  constructor (internalWriter: any) {
+    super();
+    this.#writer = internalWriter;
+    this.#writer.emit = (channel: string) => this.emit(channel);
+  }
+
+  write (data: ArrayBuffer | ArrayBufferView) : boolean {
+    return this.#writer.write(data);
+  }
+
+  close () : void {
+    this.#writer.close();
+  }
+}
+
+export class RingBufferReader extends EventEmitter implements Electron.RingBufferReader {
+  #reader: any;
+  #readablePending = false;
+  constructor (internalReader: any) {
+    super();
+    this.#reader = internalReader;
+    this.#reader.emit = (channel: string) => {
+      // 'readable' is only emitted again once the data has been read, so keep
+      // it for the first listener rather than dropping it.
+      if (channel === 'readable' && this.listenerCount('readable') === 0) {
+        this.#readablePending = true;
+        return;
+      }
+      this.emit(channel);
+    };
+    this.on('newListener', (channel: string) => {
+      if (channel === 'readable' && this.#readablePending) {
+        this.#readablePending = false;
+        process.nextTick(() => this.emit('readable'));
+      }
+    });
+  }
+
+  get readableBytes () : number {
+    return this.#reader.readableBytes;
+  }
+
+  read (view: ArrayBufferView) : number {
+    return this.#reader.read(view);
+  }
+
+  close () : void {
+    this.#reader.close();
+  }
+}
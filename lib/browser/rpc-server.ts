@@ -49,6 +49,14 @@ ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_CLIPBOARD_SYNC, function (event, me
   return (clipboard as any)[method](...args);
 });
 
+ipcMainInternal.handle(IPC_MESSAGES.BROWSER_CLIPBOARD_ASYNC, function (event, method: string, ...args: any[]) {
+  if (!allowedClipboardMethods.has(method) || !method.endsWith('Async')) {
+    throw new Error(`Invalid method: ${method}`);
+  }
+
+  return (clipboard as any)[method](...args);
+});
+
 const getPreloadScriptsFromEvent = (event: ElectronInternal.IpcMainInternalEvent) => {
   const session: Electron.Session = event.type === 'service-worker' ? event.session : event.sender.session;
   let preloadScripts = session.getPreloadScripts();
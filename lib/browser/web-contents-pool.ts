@@ -0,0 +1,150 @@
+import { webContents } from 'electron/main';
+
+import { isDeepStrictEqual } from 'util';
+
+// How long to wait before creating a replacement for a WebContents that
+// failed to load the pool's URL, doubling after every failure in a row.
+const kMinRetryDelay = 1000;
+const kMaxRetryDelay = 60 * 1000;
+
+// Keeps a number of hidden WebContents with a live, initialized renderer
+// process around so that new windows can adopt one instead of waiting for a
+// process launch. The pooled contents only load `url` (about:blank by
+// default), which leaves their renderer process unused from Chromium's point
+// of view, so the first real navigation can still reuse it.
+export class WebContentsPool {
+  #session: Electron.Session;
+  #size = 0;
+  #webPreferences: Electron.WebPreferences = {};
+  #url = 'about:blank';
+  #ready: Electron.WebContents[] = [];
+  #evictListeners = new Map<Electron.WebContents, () => void>();
+  #pending = 0;
+  #generation = 0;
+  #retryDelay = kMinRetryDelay;
+  #retryTimer: NodeJS.Timeout | null = null;
+  #hits = 0;
+  #misses = 0;
+
+  constructor (session: Electron.Session) {
+    this.#session = session;
+  }
+
+  configure (options: Electron.WebContentsPoolOptions) {
+    if (options == null || typeof options !== 'object') {
+      throw new TypeError('Must pass an options object');
+    }
+    const { size, webPreferences = {}, url = 'about:blank' } = options;
+    if (!Number.isInteger(size) || size < 0) {
+      throw new TypeError('size must be a non-negative integer');
+    }
+    if (typeof url !== 'string') {
+      throw new TypeError('url must be a string');
+    }
+
+    // Contents created for the old configuration no longer match, so replace
+    // them rather than handing out a renderer with the wrong preferences.
+    this.#generation++;
+    this.#retryDelay = kMinRetryDelay;
+    if (this.#retryTimer) {
+      clearTimeout(this.#retryTimer);
+      this.#retryTimer = null;
+    }
+    for (const contents of this.#ready.splice(0)) {
+      this.#release(contents);
+      contents.close();
+    }
+
+    this.#size = size;
+    this.#webPreferences = { ...webPreferences };
+    this.#url = url;
+    this.#fill();
+  }
+
+  // A renderer is set up for the preferences it was launched with, such as
+  // sandbox and contextIsolation, so only hand one out to a caller that asked
+  // for the same preferences.
+  take (webPreferences: Electron.WebPreferences = {}): Electron.WebContents | null {
+    const contents = isDeepStrictEqual({ ...webPreferences }, this.#webPreferences) ? this.#ready.shift() : undefined;
+    if (contents) {
+      this.#release(contents);
+      this.#hits++;
+    } else if (this.#size > 0) {
+      this.#misses++;
+    }
+    this.#fill();
+    return contents ?? null;
+  }
+
+  getStats (): Electron.WebContentsPoolStats {
+    return {
+      size: this.#size,
+      ready: this.#ready.length,
+      hits: this.#hits,
+      misses: this.#misses
+    };
+  }
+
+  // Stops watching |contents| once it leaves the pool.
+  #release (contents: Electron.WebContents) {
+    const evict = this.#evictListeners.get(contents);
+    if (!evict) return;
+    this.#evictListeners.delete(contents);
+    contents.removeListener('destroyed', evict);
+    contents.removeListener('render-process-gone', evict);
+  }
+
+  #fill () {
+    if (this.#retryTimer) return;
+    while (this.#ready.length + this.#pending < this.#size) {
+      this.#pending++;
+      this.#spawn(this.#generation);
+    }
+  }
+
+  async #spawn (generation: number) {
+    const contents = (webContents as typeof ElectronInternal.WebContents).create({
+      ...this.#webPreferences,
+      session: this.#session
+    } as Electron.WebPreferences);
+
+    try {
+      await contents.loadURL(this.#url);
+    } catch {
+      // Retrying right away would most likely fail again, so back off before
+      // topping up the pool.
+      this.#pending--;
+      if (!contents.isDestroyed()) contents.close();
+      if (generation === this.#generation && !this.#retryTimer) {
+        this.#retryTimer = setTimeout(() => {
+          this.#retryTimer = null;
+          this.#fill();
+        }, this.#retryDelay);
+        this.#retryDelay = Math.min(this.#retryDelay * 2, kMaxRetryDelay);
+      }
+      return;
+    }
+
+    this.#pending--;
+    if (generation === this.#generation) {
+      this.#retryDelay = kMinRetryDelay;
+    }
+    if (contents.isDestroyed()) return;
+    if (generation !== this.#generation || this.#ready.length >= this.#size) {
+      contents.close();
+      this.#fill();
+      return;
+    }
+
+    const evict = () => {
+      const index = this.#ready.indexOf(contents);
+      if (index !== -1) this.#ready.splice(index, 1);
+      this.#release(contents);
+      if (!contents.isDestroyed()) contents.close();
+    };
+    contents.once('destroyed', evict);
+    contents.once('render-process-gone', evict);
+    this.#evictListeners.set(contents, evict);
+    this.#ready.push(contents);
+  }
+}
@@ -1,9 +1,14 @@
 import { IPC_MESSAGES } from '@electron/internal/common/ipc-messages';
+import { ipcRendererInternal } from '@electron/internal/renderer/ipc-renderer-internal';
 import * as ipcRendererUtils from '@electron/internal/renderer/ipc-renderer-internal-utils';
 
 const clipboard = process._linkedBinding('electron_common_clipboard');
 
 const makeRemoteMethod = function (method: keyof Electron.Clipboard): any {
+  // Async methods don't block the renderer on the main process.
+  if (method.endsWith('Async')) {
+    return (...args: any[]) => ipcRendererInternal.invoke(IPC_MESSAGES.BROWSER_CLIPBOARD_ASYNC, method, ...args);
+  }
   return (...args: any[]) => ipcRendererUtils.invokeSync(IPC_MESSAGES.BROWSER_CLIPBOARD_SYNC, method, ...args);
 };
 
@@ -1,21 +1,37 @@
 import { MessagePortMain } from '@electron/internal/browser/message-port-main';
+import { kDefaultRingBufferCapacity, RingBufferReader, RingBufferWriter } from '@electron/internal/browser/ring-buffer';
 
 import { EventEmitter } from 'events';
 
 const { createParentPort } = process._linkedBinding('electron_utility_parent_port');
 
 export class ParentPort extends EventEmitter implements Electron.ParentPort {
-  #port: ParentPort;
+  #port: ElectronInternal.ParentPort;
+  #pendingRingBuffers: RingBufferReader[] = [];
   constructor () {
     super();
     this.#port = createParentPort();
-    this.#port.emit = (channel: string | symbol, event: { ports: any[] }) => {
+    this.#port.emit = (channel: string | symbol, event: any) => {
       if (channel === 'message') {
-        event = { ...event, ports: event.ports.map(p => new MessagePortMain(p)) };
+        event = { ...event, ports: event.ports.map((p: any) => new MessagePortMain(p)) };
+      } else if (channel === 'ring-buffer') {
+        event = new RingBufferReader(event);
+        // Ring buffers created by the parent before the process has set up
+        // its listener are kept for it, like messages are.
+        if (this.listenerCount('ring-buffer') === 0) {
+          this.#pendingRingBuffers.push(event);
+          return false;
+        }
       }
       this.emit(channel, event);
       return false;
     };
+    this.on('newListener', (channel: string | symbol) => {
+      if (channel === 'ring-buffer' && this.#pendingRingBuffers.length > 0) {
+        const readers = this.#pendingRingBuffers.splice(0);
+        process.nextTick(() => readers.forEach(reader => this.emit('ring-buffer', reader)));
+      }
+    });
   }
 
   start () : void {
@@ -26,7 +42,16 @@ export class ParentPort extends EventEmitter implements Electron.ParentPort {
     this.#port.pause();
   }
 
-  postMessage (message: any) : void {
+  createRingBuffer (options?: { capacity?: number }) : RingBufferWriter | null {
+    const writer = this.#port.createRingBuffer(options?.capacity ?? kDefaultRingBufferCapacity);
+    return writer ? new RingBufferWriter(writer) : null;
+  }
+
+  postMessage (message: any, transfer?: (MessagePortMain | ArrayBuffer)[]) : void {
+    if (Array.isArray(transfer)) {
+      transfer = transfer.map((o: any) => o instanceof MessagePortMain ? o._internalPort : o);
+      return this.#port.postMessage(message, transfer);
+    }
     this.#port.postMessage(message);
   }
 }
@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -42,6 +43,7 @@
 #include "shell/browser/feature_list.h"
 #include "shell/browser/relauncher.h"
 #include "shell/common/application_info.h"
+#include "shell/common/asar/archive.h"
 #include "shell/common/electron_paths.h"
 #include "shell/common/logging.h"
 #include "shell/common/options_switches.h"
@@ -87,6 +89,9 @@ namespace {
 
 constexpr std::string_view kRelauncherProcess = "relauncher";
 
+constexpr std::string_view kBrowserV8SnapshotFilename =
+    "browser_v8_context_snapshot.bin";
+
 constexpr base::cstring_view kElectronDisableSandbox{
     "ELECTRON_DISABLE_SANDBOX"};
 constexpr base::cstring_view kElectronEnableStackDumping{
@@ -213,6 +218,11 @@ void RegisterPathProvider() {
                                       PATH_END);
 }
 
+bool UseBrowserProcessSpecificV8Snapshot() {
+  return IsBrowserProcess() &&
+         electron::fuses::IsLoadBrowserProcessSpecificV8SnapshotEnabled();
+}
+
 void ValidateV8Snapshot(v8::StartupData* data) {
   if (data->data &&
       electron::fuses::IsEmbeddedAsarIntegrityValidationEnabled()) {
@@ -220,9 +230,20 @@ void ValidateV8Snapshot(v8::StartupData* data) {
     UNSAFE_BUFFERS({
       base::span<const char> span_data(
           data->data, static_cast<unsigned long>(data->raw_size));
-      CHECK(base::ToLowerASCII(base::HexEncode(
-                crypto::hash::Sha256(base::as_bytes(span_data)))) ==
-            electron::snapshot_checksum::kChecksum);
+      const std::string checksum = base::ToLowerASCII(
+          base::HexEncode(crypto::hash::Sha256(base::as_bytes(span_data))));
+      if (UseBrowserProcessSpecificV8Snapshot()) {
+        // The browser process snapshot is produced by the app rather than at
+        // build time, so its checksum comes from the app's embedded
+        // integrity config alongside the ASAR header hashes.
+        const std::optional<asar::IntegrityPayload> integrity =
+            asar::GetEmbeddedIntegrity(kBrowserV8SnapshotFilename);
+        CHECK(integrity.has_value())
+            << "Missing integrity for " << kBrowserV8SnapshotFilename;
+        CHECK_EQ(checksum, base::ToLowerASCII(integrity->hash));
+      } else {
+        CHECK(checksum == electron::snapshot_checksum::kChecksum);
+      }
     })
   }
 }
@@ -434,11 +455,8 @@ std::optional<int> ElectronMainDelegate::PreBrowserMain() {
 }
 
 std::string_view ElectronMainDelegate::GetBrowserV8SnapshotFilename() {
-  bool load_browser_process_specific_v8_snapshot =
-      IsBrowserProcess() &&
-      electron::fuses::IsLoadBrowserProcessSpecificV8SnapshotEnabled();
-  if (load_browser_process_specific_v8_snapshot) {
-    return "browser_v8_context_snapshot.bin";
+  if (UseBrowserProcessSpecificV8Snapshot()) {
+    return kBrowserV8SnapshotFilename;
   }
   return ContentMainDelegate::GetBrowserV8SnapshotFilename();
 }
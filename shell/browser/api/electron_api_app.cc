@@ -18,6 +18,7 @@
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/functional/callback_helpers.h"
+#include "base/logging.h"
 #include "base/notimplemented.h"
 #include "base/path_service.h"
 #include "base/system/sys_info.h"
@@ -62,6 +63,7 @@
 #include "shell/browser/net/resolve_proxy_helper.h"
 #include "shell/browser/relauncher.h"
 #include "shell/common/application_info.h"
+#include "shell/common/async_log_sink.h"
 #include "shell/common/electron_command_line.h"
 #include "shell/common/electron_paths.h"
 #include "shell/common/gin_converters/base_converter.h"
@@ -383,6 +385,26 @@ IconLoader::IconSize GetIconSizeByString(const std::string& size) {
   return IconLoader::IconSize::NORMAL;
 }
 
+// Writes an app-provided message to the same sink as Chromium's logging.
+void Log(gin_helper::ErrorThrower thrower,
+         const std::string& level,
+         const std::string& category,
+         const std::string& message) {
+  static constexpr auto Lookup =
+      base::MakeFixedFlatMap<std::string_view, logging::LogSeverity>({
+          {"error", logging::LOGGING_ERROR},
+          {"info", logging::LOGGING_INFO},
+          {"verbose", logging::LOGGING_VERBOSE},
+          {"warning", logging::LOGGING_WARNING},
+      });
+  const auto* iter = Lookup.find(level);
+  if (iter == Lookup.end()) {
+    thrower.ThrowTypeError("Invalid log level: " + level);
+    return;
+  }
+  log_sink::Write(iter->second, category, message);
+}
+
 // Return the path constant from string.
 int GetPathConstant(std::string_view name) {
   // clang-format off
@@ -1826,6 +1848,7 @@ gin::ObjectTemplateBuilder App::GetObjectTemplateBuilder(v8::Isolate* isolate) {
       .SetMethod("setPath", &App::SetPath)
       .SetMethod("getPath", &App::GetPath)
       .SetMethod("setAppLogsPath", &App::SetAppLogsPath)
+      .SetMethod("_log", &Log)
       .SetMethod("setDesktopName", &App::SetDesktopName)
       .SetMethod("getLocale", &App::GetLocale)
       .SetMethod("getPreferredSystemLanguages", &GetPreferredLanguages)
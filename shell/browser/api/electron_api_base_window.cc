@@ -12,6 +12,7 @@
 #include "base/task/single_thread_task_runner.h"
 #include "content/public/common/color_parser.h"
 #include "electron/buildflags/buildflags.h"
+#include "gin/data_object_builder.h"
 #include "gin/dictionary.h"
 #include "shell/browser/api/electron_api_menu.h"
 #include "shell/browser/api/electron_api_view.h"
@@ -33,6 +34,8 @@
 #include "shell/common/node_includes.h"
 #include "shell/common/node_util.h"
 #include "shell/common/options_switches.h"
+#include "ui/display/display.h"
+#include "ui/display/screen.h"
 
 #if defined(TOOLKIT_VIEWS)
 #include "shell/browser/native_window_views.h"
@@ -171,6 +174,8 @@ void BaseWindow::OnWindowClosed() {
   // there might be some delayed emit events which shouldn't be
   // triggered after this.
   weak_factory_.InvalidateWeakPtrs();
+  resize_timer_.Stop();
+  move_timer_.Stop();
 
   RemoveFromWeakMap();
   window_->RemoveObserver(this);
@@ -256,36 +261,77 @@ void BaseWindow::OnWindowRestore() {
 void BaseWindow::OnWindowWillResize(const gfx::Rect& new_bounds,
                                     const gfx::ResizeEdge edge,
                                     bool* prevent_default) {
+  if (geometry_event_interval_) {
+    const base::TimeTicks now = base::TimeTicks::Now();
+    if (now - last_will_resize_time_ < GetGeometryEventInterval()) {
+      *prevent_default = last_will_resize_prevented_;
+      return;
+    }
+    last_will_resize_time_ = now;
+  }
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
   auto info = gin::Dictionary::CreateEmpty(isolate);
   info.Set("edge", edge);
 
-  if (Emit("will-resize", new_bounds, info)) {
+  last_will_resize_prevented_ = Emit("will-resize", new_bounds, info);
+  if (last_will_resize_prevented_) {
     *prevent_default = true;
   }
 }
 
 void BaseWindow::OnWindowResize() {
-  Emit("resize");
+  if (!geometry_event_interval_) {
+    Emit("resize");
+    return;
+  }
+  ++coalesced_resize_count_;
+  if (!resize_timer_.IsRunning()) {
+    resize_timer_.Start(FROM_HERE, GetGeometryEventInterval(), this,
+                        &BaseWindow::EmitCoalescedResize);
+  }
 }
 
 void BaseWindow::OnWindowResized() {
+  // Deliver the final size before announcing that resizing has finished.
+  if (resize_timer_.IsRunning())
+    resize_timer_.FireNow();
   Emit("resized");
 }
 
 void BaseWindow::OnWindowWillMove(const gfx::Rect& new_bounds,
                                   bool* prevent_default) {
-  if (Emit("will-move", new_bounds)) {
+  if (geometry_event_interval_) {
+    const base::TimeTicks now = base::TimeTicks::Now();
+    if (now - last_will_move_time_ < GetGeometryEventInterval()) {
+      *prevent_default = last_will_move_prevented_;
+      return;
+    }
+    last_will_move_time_ = now;
+  }
+
+  last_will_move_prevented_ = Emit("will-move", new_bounds);
+  if (last_will_move_prevented_) {
     *prevent_default = true;
   }
 }
 
 void BaseWindow::OnWindowMove() {
-  Emit("move");
+  if (!geometry_event_interval_) {
+    Emit("move");
+    return;
+  }
+  ++coalesced_move_count_;
+  if (!move_timer_.IsRunning()) {
+    move_timer_.Start(FROM_HERE, GetGeometryEventInterval(), this,
+                      &BaseWindow::EmitCoalescedMove);
+  }
 }
 
 void BaseWindow::OnWindowMoved() {
+  if (move_timer_.IsRunning())
+    move_timer_.FireNow();
   Emit("moved");
 }
 
@@ -712,6 +758,32 @@ void BaseWindow::SetIgnoreMouseEvents(bool ignore,
   return window_->SetIgnoreMouseEvents(ignore, forward);
 }
 
+void BaseWindow::SetGeometryEventCoalescing(bool enable,
+                                            gin_helper::Arguments* args) {
+  // Pending events were coalesced under the old settings, so deliver them
+  // now rather than holding them for a different interval.
+  if (resize_timer_.IsRunning())
+    resize_timer_.FireNow();
+  if (move_timer_.IsRunning())
+    move_timer_.FireNow();
+  last_will_resize_time_ = base::TimeTicks();
+  last_will_move_time_ = base::TimeTicks();
+
+  if (!enable) {
+    geometry_event_interval_.reset();
+    return;
+  }
+
+  gin_helper::Dictionary options;
+  double interval = 0;
+  if (args->GetNext(&options) && options.Get("interval", &interval) &&
+      !(interval >= 0)) {
+    args->ThrowError("interval must be a non-negative number");
+    return;
+  }
+  geometry_event_interval_ = base::Milliseconds(interval);
+}
+
 void BaseWindow::SetContentProtection(bool enable) {
   return window_->SetContentProtection(enable);
 }
@@ -1126,6 +1198,37 @@ void BaseWindow::SetTitleBarOverlay(const gin_helper::Dictionary& options,
 }
 #endif
 
+base::TimeDelta BaseWindow::GetGeometryEventInterval() const {
+  if (geometry_event_interval_ && geometry_event_interval_->is_positive())
+    return *geometry_event_interval_;
+  float frequency = display::Screen::GetScreen()
+                        ->GetDisplayMatching(window_->GetBounds())
+                        .display_frequency();
+  if (frequency <= 0)
+    frequency = 60;
+  return base::Seconds(1) / frequency;
+}
+
+void BaseWindow::EmitCoalescedResize() {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  const int count = std::exchange(coalesced_resize_count_, 0);
+  Emit("resize", gin::DataObjectBuilder(isolate)
+                     .Set("bounds", window_->GetBounds())
+                     .Set("coalescedCount", count)
+                     .Build());
+}
+
+void BaseWindow::EmitCoalescedMove() {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  const int count = std::exchange(coalesced_move_count_, 0);
+  Emit("move", gin::DataObjectBuilder(isolate)
+                   .Set("bounds", window_->GetBounds())
+                   .Set("coalescedCount", count)
+                   .Build());
+}
+
 void BaseWindow::RemoveFromParentChildWindows() {
   if (parent_window_.IsEmpty())
     return;
@@ -1231,6 +1334,8 @@ void BaseWindow::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("setDocumentEdited", &BaseWindow::SetDocumentEdited)
       .SetMethod("isDocumentEdited", &BaseWindow::IsDocumentEdited)
       .SetMethod("setIgnoreMouseEvents", &BaseWindow::SetIgnoreMouseEvents)
+      .SetMethod("setGeometryEventCoalescing",
+                 &BaseWindow::SetGeometryEventCoalescing)
       .SetMethod("setContentProtection", &BaseWindow::SetContentProtection)
       .SetMethod("isContentProtected", &BaseWindow::IsContentProtected)
       .SetMethod("setFocusable", &BaseWindow::SetFocusable)
@@ -13,6 +13,8 @@
 #include <string_view>
 #include <vector>
 
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "shell/browser/native_window_observer.h"
@@ -178,6 +180,7 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
   void SetDocumentEdited(bool edited);
   bool IsDocumentEdited() const;
   void SetIgnoreMouseEvents(bool ignore, gin_helper::Arguments* args);
+  void SetGeometryEventCoalescing(bool enable, gin_helper::Arguments* args);
   void SetContentProtection(bool enable);
   bool IsContentProtected() const;
   void SetFocusable(bool focusable);
@@ -271,6 +274,11 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
   // Remove this window from parent window's |child_windows_|.
   void RemoveFromParentChildWindows();
 
+  // Geometry event coalescing.
+  base::TimeDelta GetGeometryEventInterval() const;
+  void EmitCoalescedResize();
+  void EmitCoalescedMove();
+
   template <typename... Args>
   void EmitEventSoon(std::string_view eventName) {
     content::GetUIThreadTaskRunner({})->PostTask(
@@ -291,6 +299,21 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
 
   std::unique_ptr<NativeWindow> window_;
 
+  // Set while 'resize' and 'move' events are being coalesced. A zero interval
+  // follows the refresh rate of the window's display.
+  std::optional<base::TimeDelta> geometry_event_interval_;
+  base::OneShotTimer resize_timer_;
+  base::OneShotTimer move_timer_;
+  int coalesced_resize_count_ = 0;
+  int coalesced_move_count_ = 0;
+  // 'will-resize' and 'will-move' need an answer synchronously, so while
+  // coalescing they are only emitted once per interval and the notifications
+  // in between reuse the last answer.
+  base::TimeTicks last_will_resize_time_;
+  bool last_will_resize_prevented_ = false;
+  base::TimeTicks last_will_move_time_;
+  bool last_will_move_prevented_ = false;
+
   // Reference to JS wrapper to prevent garbage collection.
   v8::Global<v8::Value> self_ref_;
 
@@ -24,10 +24,12 @@
 #include "net/cookies/cookie_store.h"
 #include "net/cookies/cookie_util.h"
 #include "shell/browser/cookie_change_notifier.h"
+#include "shell/browser/cookie_mirror.h"
 #include "shell/browser/electron_browser_context.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_converters/gurl_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
+#include "shell/common/gin_helper/arguments.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/handle.h"
 #include "shell/common/gin_helper/object_template_builder.h"
@@ -96,41 +98,31 @@ struct Converter<net::CookieChangeCause> {
   }
 };
 
+template <>
+struct Converter<net::CookieChangeInfo> {
+  static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
+                                   const net::CookieChangeInfo& val) {
+    gin::Dictionary dict(isolate, v8::Object::New(isolate));
+    dict.Set("cookie", val.cookie);
+    dict.Set("cause", val.cause);
+    dict.Set("removed", val.cause != net::CookieChangeCause::INSERTED);
+    return ConvertToV8(isolate, dict).As<v8::Object>();
+  }
+};
+
 }  // namespace gin
 
 namespace electron::api {
 
 namespace {
 
-// Returns whether |cookie| matches |filter|.
-bool MatchesCookie(const base::Value::Dict& filter,
-                   const net::CanonicalCookie& cookie) {
-  const std::string* str;
-  if ((str = filter.FindString("name")) && *str != cookie.Name())
-    return false;
-  if ((str = filter.FindString("path")) && *str != cookie.Path())
-    return false;
-  if ((str = filter.FindString("domain")) && !cookie.IsDomainMatch(*str))
-    return false;
-  std::optional<bool> secure_filter = filter.FindBool("secure");
-  if (secure_filter && *secure_filter != cookie.SecureAttribute())
-    return false;
-  std::optional<bool> session_filter = filter.FindBool("session");
-  if (session_filter && *session_filter == cookie.IsPersistent())
-    return false;
-  std::optional<bool> httpOnly_filter = filter.FindBool("httpOnly");
-  if (httpOnly_filter && *httpOnly_filter != cookie.IsHttpOnly())
-    return false;
-  return true;
-}
-
 // Remove cookies from |list| not matching |filter|, and pass it to |callback|.
 void FilterCookies(base::Value::Dict filter,
                    gin_helper::Promise<net::CookieList> promise,
                    const net::CookieList& cookies) {
   net::CookieList result;
   for (const auto& cookie : cookies) {
-    if (MatchesCookie(filter, cookie))
+    if (CookieMirror::MatchesFilter(filter, cookie))
       result.push_back(cookie);
   }
   promise.Resolve(result);
@@ -318,6 +310,25 @@ v8::Local<v8::Promise> Cookies::Get(v8::Isolate* isolate,
   return handle;
 }
 
+v8::Local<v8::Promise> Cookies::GetCached(
+    v8::Isolate* isolate,
+    const gin_helper::Dictionary& filter) {
+  gin_helper::Promise<net::CookieList> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  base::Value::Dict dict;
+  gin::ConvertFromV8(isolate, filter.GetHandle(), &dict);
+
+  if (!mirror_)
+    mirror_ = std::make_unique<CookieMirror>(browser_context_);
+  mirror_->Query(
+      std::move(dict),
+      base::BindOnce(gin_helper::Promise<net::CookieList>::ResolvePromise,
+                     std::move(promise)));
+
+  return handle;
+}
+
 v8::Local<v8::Promise> Cookies::Remove(v8::Isolate* isolate,
                                        const GURL& url,
                                        const std::string& name) {
@@ -334,10 +345,14 @@ v8::Local<v8::Promise> Cookies::Remove(v8::Isolate* isolate,
   manager->DeleteCookies(
       std::move(cookie_deletion_filter),
       base::BindOnce(
-          [](gin_helper::Promise<void> promise, uint32_t num_deleted) {
+          [](gin_helper::Promise<void> promise,
+             base::WeakPtr<CookieMirror> mirror, const GURL& url,
+             const std::string& name, uint32_t num_deleted) {
+            if (mirror)
+              mirror->OnCookiesRemoved(url, name);
             gin_helper::Promise<void>::ResolvePromise(std::move(promise));
           },
-          std::move(promise)));
+          std::move(promise), GetMirrorWeakPtr(), url, name));
 
   return handle;
 }
@@ -407,14 +422,18 @@ v8::Local<v8::Promise> Cookies::Set(v8::Isolate* isolate,
   manager->SetCanonicalCookie(
       *canonical_cookie, url, options,
       base::BindOnce(
-          [](gin_helper::Promise<void> promise, net::CookieAccessResult r) {
+          [](gin_helper::Promise<void> promise,
+             base::WeakPtr<CookieMirror> mirror,
+             const net::CanonicalCookie& cookie, net::CookieAccessResult r) {
             if (r.status.IsInclude()) {
+              if (mirror)
+                mirror->OnCookieSet(cookie);
               promise.Resolve();
             } else {
               promise.RejectWithErrorMessage(InclusionStatusToString(r.status));
             }
           },
-          std::move(promise)));
+          std::move(promise), GetMirrorWeakPtr(), *canonical_cookie));
 
   return handle;
 }
@@ -432,7 +451,67 @@ v8::Local<v8::Promise> Cookies::FlushStore(v8::Isolate* isolate) {
   return handle;
 }
 
+base::WeakPtr<CookieMirror> Cookies::GetMirrorWeakPtr() {
+  return mirror_ ? mirror_->GetWeakPtr() : nullptr;
+}
+
+void Cookies::SetChangeBatching(bool enable, gin_helper::Arguments* args) {
+  // Changes batched under the old settings are delivered now.
+  if (change_batch_timer_.IsRunning())
+    change_batch_timer_.FireNow();
+
+  if (!enable) {
+    change_batching_.reset();
+    return;
+  }
+
+  ChangeBatching batching;
+  gin_helper::Dictionary options;
+  double interval = 100;
+  if (args->GetNext(&options)) {
+    if (options.Get("interval", &interval) && !(interval >= 0)) {
+      args->ThrowError("interval must be a non-negative number");
+      return;
+    }
+    std::string value;
+    if (options.Get("domain", &value))
+      batching.domain = std::move(value);
+    if (options.Get("name", &value))
+      batching.name = std::move(value);
+  }
+  batching.interval = base::Milliseconds(interval);
+  change_batching_ = std::move(batching);
+}
+
+bool Cookies::IsBatchedChange(const net::CanonicalCookie& cookie) const {
+  return (!change_batching_->domain ||
+          cookie.IsDomainMatch(*change_batching_->domain)) &&
+         (!change_batching_->name || cookie.Name() == *change_batching_->name);
+}
+
+void Cookies::EmitChangeBatch() {
+  if (batched_changes_.empty())
+    return;
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  Emit("changed-batch",
+       gin::ConvertToV8(isolate, std::exchange(batched_changes_, {})));
+}
+
 void Cookies::OnCookieChanged(const net::CookieChangeInfo& change) {
+  if (change_batching_) {
+    // Filter here so that unwanted changes never reach JS.
+    if (!IsBatchedChange(change.cookie))
+      return;
+    batched_changes_.push_back(change);
+    if (!change_batch_timer_.IsRunning()) {
+      change_batch_timer_.Start(FROM_HERE, change_batching_->interval,
+                                base::BindOnce(&Cookies::EmitChangeBatch,
+                                               base::Unretained(this)));
+    }
+    return;
+  }
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope scope(isolate);
   Emit("changed", gin::ConvertToV8(isolate, change.cookie),
@@ -453,9 +532,11 @@ gin::ObjectTemplateBuilder Cookies::GetObjectTemplateBuilder(
   return gin_helper::EventEmitterMixin<Cookies>::GetObjectTemplateBuilder(
              isolate)
       .SetMethod("get", &Cookies::Get)
+      .SetMethod("getCached", &Cookies::GetCached)
       .SetMethod("remove", &Cookies::Remove)
       .SetMethod("set", &Cookies::Set)
-      .SetMethod("flushStore", &Cookies::FlushStore);
+      .SetMethod("flushStore", &Cookies::FlushStore)
+      .SetMethod("setChangeBatching", &Cookies::SetChangeBatching);
 }
 
 const char* Cookies::GetTypeName() {
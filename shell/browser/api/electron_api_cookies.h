@@ -5,28 +5,33 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_COOKIES_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_COOKIES_H_
 
+#include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "base/callback_list.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "base/values.h"
+#include "net/cookies/cookie_change_dispatcher.h"
 #include "shell/browser/event_emitter_mixin.h"
 #include "shell/common/gin_helper/wrappable.h"
 
 class GURL;
 
 namespace gin_helper {
+class Arguments;
 class Dictionary;
 template <typename T>
 class Handle;
 }  // namespace gin_helper
 
-namespace net {
-struct CookieChangeInfo;
-}  // namespace net
-
 namespace electron {
 
+class CookieMirror;
 class ElectronBrowserContext;
 
 namespace api {
@@ -54,18 +59,42 @@ class Cookies final : public gin_helper::DeprecatedWrappable<Cookies>,
 
   v8::Local<v8::Promise> Get(v8::Isolate*,
                              const gin_helper::Dictionary& filter);
+  v8::Local<v8::Promise> GetCached(v8::Isolate*,
+                                   const gin_helper::Dictionary& filter);
   v8::Local<v8::Promise> Set(v8::Isolate*, base::Value::Dict details);
   v8::Local<v8::Promise> Remove(v8::Isolate*,
                                 const GURL& url,
                                 const std::string& name);
   v8::Local<v8::Promise> FlushStore(v8::Isolate*);
+  void SetChangeBatching(bool enable, gin_helper::Arguments* args);
 
   // CookieChangeNotifier subscription:
   void OnCookieChanged(const net::CookieChangeInfo& change);
 
  private:
+  struct ChangeBatching {
+    base::TimeDelta interval;
+    std::optional<std::string> domain;
+    std::optional<std::string> name;
+  };
+
+  base::WeakPtr<CookieMirror> GetMirrorWeakPtr();
+
+  // Whether |cookie| passes the domain and name filters of |change_batching_|.
+  bool IsBatchedChange(const net::CanonicalCookie& cookie) const;
+  void EmitChangeBatch();
+
   base::CallbackListSubscription cookie_change_subscription_;
 
+  // When set, changes are delivered in batches by the 'changed-batch' event
+  // instead of one 'changed' event each.
+  std::optional<ChangeBatching> change_batching_;
+  std::vector<net::CookieChangeInfo> batched_changes_;
+  base::OneShotTimer change_batch_timer_;
+
+  // Created by the first getCached() call.
+  std::unique_ptr<CookieMirror> mirror_;
+
   // Weak reference; ElectronBrowserContext is guaranteed to outlive us.
   raw_ptr<ElectronBrowserContext> browser_context_;
 };
@@ -5,6 +5,7 @@
 #include "shell/browser/api/electron_api_session.h"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <set>
 #include <string>
@@ -44,6 +45,7 @@
 #include "content/public/browser/storage_partition.h"
 #include "gin/arguments.h"
 #include "gin/converter.h"
+#include "gin/data_object_builder.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "mojo/public/cpp/bindings/self_owned_receiver.h"
 #include "net/base/completion_repeating_callback.h"
@@ -415,6 +417,27 @@ struct Converter<ClearStorageDataOptions> {
   }
 };
 
+template <>
+struct Converter<electron::ElectronPermissionManager::CheckResult> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::ElectronPermissionManager::CheckResult* out) {
+    // The handler can return either a boolean or { granted, cacheFor }.
+    if (!val->IsObject()) {
+      out->granted = val->BooleanValue(isolate);
+      return true;
+    }
+    gin_helper::Dictionary dict;
+    if (!ConvertFromV8(isolate, val, &dict) ||
+        !dict.Get("granted", &out->granted))
+      return false;
+    if (double cache_for = 0; dict.Get("cacheFor", &cache_for) &&
+                              std::isfinite(cache_for) && cache_for > 0)
+      out->cache_for = base::Milliseconds(cache_for);
+    return true;
+  }
+};
+
 bool SSLProtocolVersionFromString(const std::string& version_str,
                                   network::mojom::SSLVersion* version) {
   if (version_str == switches::kSSLVersionTLSv12) {
@@ -715,6 +738,11 @@ v8::Local<v8::Promise> Session::ClearStorageData(gin::Arguments* args) {
 
   ClearStorageDataOptions options;
   args->GetNext(&options);
+  // Only passed by incremental clears, see lib/browser/api/session.ts.
+  if (std::vector<std::string> excluded_storages;
+      args->GetNext(&excluded_storages)) {
+    options.storage_types &= ~GetStorageMask(excluded_storages);
+  }
 
   if (options.storage_types & StoragePartition::REMOVE_DATA_MASK_COOKIES) {
     // Reset media device id salt when cookies are cleared.
@@ -882,6 +910,25 @@ void Session::SetPermissionCheckHandler(v8::Local<v8::Value> val,
   permission_manager->SetPermissionCheckHandler(handler);
 }
 
+void Session::ClearPermissionCheckCache() {
+  auto* permission_manager = static_cast<ElectronPermissionManager*>(
+      browser_context()->GetPermissionControllerDelegate());
+  permission_manager->ClearCheckCache();
+}
+
+v8::Local<v8::Value> Session::GetPermissionCheckCacheStats(
+    v8::Isolate* isolate) {
+  auto* permission_manager = static_cast<ElectronPermissionManager*>(
+      browser_context()->GetPermissionControllerDelegate());
+  const ElectronPermissionManager::CheckCacheStats stats =
+      permission_manager->GetCheckCacheStats();
+  return gin::DataObjectBuilder(isolate)
+      .Set("hits", static_cast<double>(stats.hits))
+      .Set("misses", static_cast<double>(stats.misses))
+      .Set("entries", static_cast<double>(stats.entries))
+      .Build();
+}
+
 void Session::SetDisplayMediaRequestHandler(v8::Isolate* isolate,
                                             v8::Local<v8::Value> val) {
   if (val->IsNull()) {
@@ -1469,6 +1516,13 @@ v8::Local<v8::Value> Session::ClearData(gin_helper::ErrorThrower thrower,
       data_type_mask = GetDataTypeMask(data_types);
     }
 
+    // Only passed by incremental clears, whose last step clears everything
+    // but the types it clears one at a time. See lib/browser/api/session.ts.
+    if (std::vector<std::string> excluded_data_types;
+        args->GetNext(&excluded_data_types)) {
+      data_type_mask &= ~GetDataTypeMask(excluded_data_types);
+    }
+
     if (bool avoid_closing_connections;
         options.Get("avoidClosingConnections", &avoid_closing_connections) &&
         avoid_closing_connections) {
@@ -1757,6 +1811,10 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
                  &Session::SetPermissionRequestHandler)
       .SetMethod("setPermissionCheckHandler",
                  &Session::SetPermissionCheckHandler)
+      .SetMethod("clearPermissionCheckCache",
+                 &Session::ClearPermissionCheckCache)
+      .SetMethod("getPermissionCheckCacheStats",
+                 &Session::GetPermissionCheckCacheStats)
       .SetMethod("_setDisplayMediaRequestHandler",
                  &Session::SetDisplayMediaRequestHandler)
       .SetMethod("setDevicePermissionHandler",
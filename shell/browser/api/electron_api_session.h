@@ -123,6 +123,8 @@ class Session final : public gin_helper::DeprecatedWrappable<Session>,
                                    gin::Arguments* args);
   void SetPermissionCheckHandler(v8::Local<v8::Value> val,
                                  gin::Arguments* args);
+  void ClearPermissionCheckCache();
+  v8::Local<v8::Value> GetPermissionCheckCacheStats(v8::Isolate* isolate);
   void SetDevicePermissionHandler(v8::Local<v8::Value> val,
                                   gin::Arguments* args);
   void SetUSBProtectedClassesHandler(v8::Local<v8::Value> val,
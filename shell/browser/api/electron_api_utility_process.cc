@@ -20,6 +20,7 @@
 #include "gin/object_template_builder.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "shell/browser/api/message_port.h"
+#include "shell/browser/api/ring_buffer.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/net/system_network_context_manager.h"
@@ -334,42 +335,30 @@ void UtilityProcessWrapper::PostMessage(gin::Arguments* args) {
     return;
 
   blink::TransferableMessage transferable_message;
-  gin_helper::ErrorThrower thrower(args->isolate());
 
   // |message| is any value that can be serialized to StructuredClone.
   v8::Local<v8::Value> message_value;
-  if (args->GetNext(&message_value)) {
-    if (!electron::SerializeV8Value(args->isolate(), message_value,
-                                    &transferable_message)) {
-      // SerializeV8Value sets an exception.
-      return;
-    }
-  }
+  args->GetNext(&message_value);
 
   v8::Local<v8::Value> transferables;
   std::vector<gin_helper::Handle<MessagePort>> wrapped_ports;
-  if (args->GetNext(&transferables)) {
-    std::vector<v8::Local<v8::Value>> wrapped_port_values;
-    if (!gin::ConvertFromV8(args->isolate(), transferables,
-                            &wrapped_port_values)) {
-      thrower.ThrowTypeError("transferables must be an array of MessagePorts");
-      return;
-    }
+  std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+  if (args->GetNext(&transferables) &&
+      !MessagePort::ConvertTransferables(args->isolate(), transferables,
+                                         &wrapped_ports, &array_buffers)) {
+    return;
+  }
 
-    for (size_t i = 0; i < wrapped_port_values.size(); ++i) {
-      if (!gin_helper::IsValidWrappable(wrapped_port_values[i],
-                                        &MessagePort::kWrapperInfo)) {
-        thrower.ThrowTypeError(
-            base::StrCat({"Port at index ", base::NumberToString(i),
-                          " is not a valid port"}));
-        return;
-      }
-    }
+  // Serializing detaches the transferred ArrayBuffers, so the ports have to
+  // be checked before that.
+  if (!MessagePort::ValidatePorts(args->isolate(), wrapped_ports))
+    return;
 
-    if (!gin::ConvertFromV8(args->isolate(), transferables, &wrapped_ports)) {
-      thrower.ThrowTypeError("Passed an invalid MessagePort");
-      return;
-    }
+  if (!message_value.IsEmpty() &&
+      !electron::SerializeV8Value(args->isolate(), message_value,
+                                  array_buffers, &transferable_message)) {
+    // SerializeV8Value sets an exception.
+    return;
   }
 
   bool threw_exception = false;
@@ -383,6 +372,20 @@ void UtilityProcessWrapper::PostMessage(gin::Arguments* args) {
   connector_->Accept(&mojo_message);
 }
 
+v8::Local<v8::Value> UtilityProcessWrapper::CreateRingBuffer(
+    v8::Isolate* isolate,
+    uint32_t capacity) {
+  mojo::ScopedDataPipeConsumerHandle consumer;
+  auto writer = RingBufferWriter::Create(isolate, capacity, &consumer);
+  if (writer.IsEmpty())
+    return v8::Null(isolate);
+  // The reader closes right away, and so does the writer, when the process
+  // has exited.
+  if (node_service_remote_.is_connected())
+    node_service_remote_->ReceiveRingBuffer(std::move(consumer));
+  return writer.ToV8();
+}
+
 bool UtilityProcessWrapper::Kill() {
   if (pid_ == base::kNullProcessId)
     return false;
@@ -427,6 +430,14 @@ void UtilityProcessWrapper::OnV8FatalError(const std::string& location,
   EmitWithoutEvent("error", "FatalError", location, report);
 }
 
+void UtilityProcessWrapper::ReceiveRingBuffer(
+    mojo::ScopedDataPipeConsumerHandle consumer) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  EmitWithoutEvent("ring-buffer",
+                   RingBufferReader::Create(isolate, std::move(consumer)));
+}
+
 // static
 raw_ptr<UtilityProcessWrapper> UtilityProcessWrapper::FromProcessId(
     base::ProcessId pid) {
@@ -513,6 +524,7 @@ gin::ObjectTemplateBuilder UtilityProcessWrapper::GetObjectTemplateBuilder(
   return gin_helper::EventEmitterMixin<
              UtilityProcessWrapper>::GetObjectTemplateBuilder(isolate)
       .SetMethod("postMessage", &UtilityProcessWrapper::PostMessage)
+      .SetMethod("createRingBuffer", &UtilityProcessWrapper::CreateRingBuffer)
       .SetMethod("kill", &UtilityProcessWrapper::Kill)
       .SetProperty("pid", &UtilityProcessWrapper::GetOSProcessId);
 }
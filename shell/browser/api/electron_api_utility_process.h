@@ -79,6 +79,8 @@ class UtilityProcessWrapper final
   void HandleTermination(uint64_t exit_code);
 
   void PostMessage(gin::Arguments* args);
+  v8::Local<v8::Value> CreateRingBuffer(v8::Isolate* isolate,
+                                        uint32_t capacity);
   bool Kill();
   v8::Local<v8::Value> GetOSProcessId(v8::Isolate* isolate) const;
 
@@ -88,6 +90,7 @@ class UtilityProcessWrapper final
   // node::mojom::NodeServiceClient
   void OnV8FatalError(const std::string& location,
                       const std::string& report) override;
+  void ReceiveRingBuffer(mojo::ScopedDataPipeConsumerHandle consumer) override;
 
   // content::ServiceProcessHost::Observer
   void OnServiceProcessTerminatedNormally(
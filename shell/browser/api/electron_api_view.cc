@@ -14,6 +14,7 @@
 #include "gin/data_object_builder.h"
 #include "gin/wrappable.h"
 #include "shell/browser/javascript_environment.h"
+#include "shell/browser/ui/views/constraint_layout.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/gfx_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -144,6 +145,61 @@ struct Converter<views::SizeBounds> {
         .Build();
   }
 };
+
+template <>
+struct Converter<electron::GridTrack> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::GridTrack* out) {
+    // A bare number is a fixed size track.
+    if (val->IsNumber())
+      return ConvertFromV8(isolate, val, &out->size) && out->size >= 0;
+    gin_helper::Dictionary dict;
+    if (!ConvertFromV8(isolate, val, &dict))
+      return false;
+    dict.Get("size", &out->size);
+    dict.Get("flex", &out->flex);
+    dict.Get("minimumSize", &out->minimum_size);
+    dict.GetOptional("maximumSize", &out->maximum_size);
+    return out->size >= 0 && out->flex >= 0 && out->minimum_size >= 0 &&
+           out->maximum_size.value_or(0) >= 0;
+  }
+};
+
+template <>
+struct Converter<electron::LayoutConstraints> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::LayoutConstraints* out) {
+    gin_helper::Dictionary dict;
+    if (!ConvertFromV8(isolate, val, &dict))
+      return false;
+    dict.GetOptional("flex", &out->flex);
+    dict.GetOptional("order", &out->flex_order);
+    dict.Get("column", &out->column);
+    dict.Get("row", &out->row);
+    dict.Get("columnSpan", &out->column_span);
+    dict.Get("rowSpan", &out->row_span);
+    dict.GetOptional("left", &out->left);
+    dict.GetOptional("top", &out->top);
+    dict.GetOptional("right", &out->right);
+    dict.GetOptional("bottom", &out->bottom);
+    dict.GetOptional("width", &out->width);
+    dict.GetOptional("height", &out->height);
+    dict.Get("minimumWidth", &out->minimum_width);
+    dict.Get("minimumHeight", &out->minimum_height);
+    dict.GetOptional("maximumWidth", &out->maximum_width);
+    dict.GetOptional("maximumHeight", &out->maximum_height);
+    // Anchors may be negative to place a child partly outside its parent, but
+    // cells, spans and sizes can't be.
+    return out->flex.value_or(0) >= 0 && out->column >= 0 && out->row >= 0 &&
+           out->column_span >= 1 && out->row_span >= 1 &&
+           out->width.value_or(0) >= 0 && out->height.value_or(0) >= 0 &&
+           out->minimum_width >= 0 && out->minimum_height >= 0 &&
+           out->maximum_width.value_or(0) >= 0 &&
+           out->maximum_height.value_or(0) >= 0;
+  }
+};
 }  // namespace gin
 
 namespace electron::api {
@@ -297,9 +353,43 @@ void View::SetLayout(v8::Isolate* isolate, v8::Local<v8::Object> value) {
     return;
   gin_helper::Dictionary dict(isolate, value);
   LayoutCallback calculate_proposed_layout;
+  std::string type;
+  dict.Get("type", &type);
   if (dict.Get("calculateProposedLayout", &calculate_proposed_layout)) {
     view_->SetLayoutManager(std::make_unique<JSLayoutManager>(
         std::move(calculate_proposed_layout)));
+  } else if (type == "grid") {
+    std::vector<GridTrack> columns, rows;
+    if (dict.Has("columns") && !dict.Get("columns", &columns)) {
+      gin_helper::ErrorThrower(isolate).ThrowTypeError("Invalid columns");
+      return;
+    }
+    if (dict.Has("rows") && !dict.Get("rows", &rows)) {
+      gin_helper::ErrorThrower(isolate).ThrowTypeError("Invalid rows");
+      return;
+    }
+    // Without explicit tracks the grid is a single flexible cell.
+    if (columns.empty())
+      columns.push_back({.flex = 1});
+    if (rows.empty())
+      rows.push_back({.flex = 1});
+    int column_gap = 0, row_gap = 0;
+    dict.Get("columnGap", &column_gap);
+    dict.Get("rowGap", &row_gap);
+    if (column_gap < 0 || row_gap < 0) {
+      gin_helper::ErrorThrower(isolate).ThrowTypeError("Invalid gap");
+      return;
+    }
+    gfx::Insets interior_margin;
+    dict.Get("interiorMargin", &interior_margin);
+    view_->SetLayoutManager(std::make_unique<GridLayout>(
+        std::move(columns), std::move(rows), column_gap, row_gap,
+        interior_margin));
+  } else if (type == "anchor") {
+    view_->SetLayoutManager(std::make_unique<AnchorLayout>());
+  } else if (!type.empty() && type != "flex") {
+    gin_helper::ErrorThrower(isolate).ThrowTypeError(
+        "Invalid layout type, must be one of 'flex', 'grid' or 'anchor'");
   } else {
     auto* layout =
         view_->SetLayoutManager(std::make_unique<views::FlexLayout>());
@@ -337,6 +427,23 @@ void View::SetLayout(v8::Isolate* isolate, v8::Local<v8::Object> value) {
   }
 }
 
+void View::SetLayoutConstraints(v8::Isolate* isolate,
+                                v8::Local<v8::Value> value) {
+  if (!view_)
+    return;
+  std::optional<LayoutConstraints> constraints;
+  if (!value->IsNullOrUndefined()) {
+    LayoutConstraints converted;
+    if (!gin::ConvertFromV8(isolate, value, &converted)) {
+      gin_helper::ErrorThrower(isolate).ThrowTypeError(
+          "Invalid layout constraints");
+      return;
+    }
+    constraints = std::move(converted);
+  }
+  electron::SetLayoutConstraints(view_, std::move(constraints));
+}
+
 std::vector<v8::Local<v8::Value>> View::GetChildren() {
   std::vector<v8::Local<v8::Value>> ret;
   ret.reserve(child_views_.size());
@@ -456,6 +563,7 @@ void View::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("setBackgroundColor", &View::SetBackgroundColor)
       .SetMethod("setBorderRadius", &View::SetBorderRadius)
       .SetMethod("setLayout", &View::SetLayout)
+      .SetMethod("setLayoutConstraints", &View::SetLayoutConstraints)
       .SetMethod("setVisible", &View::SetVisible)
       .SetMethod("getVisible", &View::GetVisible);
 }
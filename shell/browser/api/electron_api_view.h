@@ -40,6 +40,8 @@ class View : public gin_helper::EventEmitter<View>,
   void SetBounds(const gfx::Rect& bounds);
   gfx::Rect GetBounds() const;
   void SetLayout(v8::Isolate* isolate, v8::Local<v8::Object> value);
+  void SetLayoutConstraints(v8::Isolate* isolate,
+                            v8::Local<v8::Value> value);
   std::vector<v8::Local<v8::Value>> GetChildren();
   void SetBackgroundColor(std::optional<WrappedSkColor> color);
   void SetBorderRadius(int radius);
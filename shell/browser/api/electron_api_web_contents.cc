@@ -25,6 +25,7 @@
 #include "base/strings/strcat.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/current_thread.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/scoped_blocking_call.h"
 #include "base/unguessable_token.h"
 #include "base/values.h"
@@ -240,6 +241,21 @@ struct Converter<printing::mojom::DuplexMode> {
 
 #endif
 
+template <>
+struct Converter<electron::mojom::HeapSnapshotCompression> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::mojom::HeapSnapshotCompression* out) {
+    using Val = electron::mojom::HeapSnapshotCompression;
+    static constexpr auto Lookup =
+        base::MakeFixedFlatMap<std::string_view, Val>({
+            {"gzip", Val::kGzip},
+            {"none", Val::kNone},
+        });
+    return FromV8WithLookup(isolate, val, Lookup, out);
+  }
+};
+
 template <>
 struct Converter<WindowOpenDisposition> {
   static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
@@ -708,6 +724,29 @@ content::RenderFrameHost* GetRenderFrameHost(
 
   return frame_host;
 }
+
+// Binds the ElectronRenderer interface of the primary main frame, or sets
+// |error| and returns nullptr when the frame is not usable.
+std::unique_ptr<mojo::Remote<mojom::ElectronRenderer>>
+BindMainFrameRenderer(content::WebContents* web_contents,
+                      std::string_view* error) {
+  auto* frame_host = web_contents->GetPrimaryMainFrame();
+  if (!frame_host) {
+    *error = "invalid webContents main frame";
+    return nullptr;
+  }
+
+  if (!frame_host->IsRenderFrameLive()) {
+    *error = "nonexistent render frame";
+    return nullptr;
+  }
+
+  auto electron_renderer =
+      std::make_unique<mojo::Remote<mojom::ElectronRenderer>>();
+  frame_host->GetRemoteInterfaces()->GetInterface(
+      electron_renderer->BindNewPipeAndPassReceiver());
+  return electron_renderer;
+}
 }  // namespace
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
@@ -3026,6 +3065,104 @@ void OnPDFCreated(gin_helper::Promise<v8::Local<v8::Value>> promise,
 
   promise.Resolve(buffer);
 }
+
+// Writes the PDF straight to |path| on a background thread, so the document
+// is never copied into a Buffer.
+void OnPDFCreatedForFile(const base::FilePath& path,
+                         gin_helper::Promise<void> promise,
+                         print_to_pdf::PdfPrintResult print_result,
+                         scoped_refptr<base::RefCountedMemory> data) {
+  if (print_result != print_to_pdf::PdfPrintResult::kPrintSuccess) {
+    promise.RejectWithErrorMessage(
+        "Failed to generate PDF: " +
+        print_to_pdf::PdfPrintResultToString(print_result));
+    return;
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(
+          [](const base::FilePath& path,
+             scoped_refptr<base::RefCountedMemory> data) {
+            return base::WriteFile(path, *data);
+          },
+          path, std::move(data)),
+      base::BindOnce(
+          [](gin_helper::Promise<void> promise, const base::FilePath& path,
+             bool success) {
+            if (success)
+              promise.Resolve();
+            else
+              promise.RejectWithErrorMessage("Failed to write PDF to " +
+                                             path.AsUTF8Unsafe());
+          },
+          std::move(promise), path));
+}
+
+// Starts printing the page shown in |web_contents| to PDF with |settings|.
+// |on_created| is run with |promise| once the document has been generated.
+// Partially duplicated and modified from
+// headless/lib/browser/protocol/page_handler.cc;l=41
+template <typename T>
+void StartPrintToPDF(
+    content::WebContents* web_contents,
+    const base::Value& settings,
+    gin_helper::Promise<T> promise,
+    base::OnceCallback<void(gin_helper::Promise<T>,
+                            print_to_pdf::PdfPrintResult,
+                            scoped_refptr<base::RefCountedMemory>)>
+        on_created) {
+  // This allows us to track headless printing calls.
+  auto unique_id = settings.GetDict().FindInt(printing::kPreviewRequestID);
+  auto landscape = settings.GetDict().FindBool("landscape");
+  auto display_header_footer =
+      settings.GetDict().FindBool("displayHeaderFooter");
+  auto print_background = settings.GetDict().FindBool("printBackground");
+  auto scale = settings.GetDict().FindDouble("scale");
+  auto paper_width = settings.GetDict().FindDouble("paperWidth");
+  auto paper_height = settings.GetDict().FindDouble("paperHeight");
+  auto margin_top = settings.GetDict().FindDouble("marginTop");
+  auto margin_bottom = settings.GetDict().FindDouble("marginBottom");
+  auto margin_left = settings.GetDict().FindDouble("marginLeft");
+  auto margin_right = settings.GetDict().FindDouble("marginRight");
+  auto page_ranges = *settings.GetDict().FindString("pageRanges");
+  auto header_template = *settings.GetDict().FindString("headerTemplate");
+  auto footer_template = *settings.GetDict().FindString("footerTemplate");
+  auto prefer_css_page_size = settings.GetDict().FindBool("preferCSSPageSize");
+  auto generate_tagged_pdf = settings.GetDict().FindBool("generateTaggedPDF");
+  auto generate_document_outline =
+      settings.GetDict().FindBool("generateDocumentOutline");
+
+  content::RenderFrameHost* rfh = GetRenderFrameHostToUse(web_contents);
+  absl::variant<printing::mojom::PrintPagesParamsPtr, std::string>
+      print_pages_params = print_to_pdf::GetPrintPagesParams(
+          rfh->GetLastCommittedURL(), landscape, display_header_footer,
+          print_background, scale, paper_width, paper_height, margin_top,
+          margin_bottom, margin_left, margin_right,
+          std::make_optional(header_template),
+          std::make_optional(footer_template), prefer_css_page_size,
+          generate_tagged_pdf, generate_document_outline);
+
+  if (absl::holds_alternative<std::string>(print_pages_params)) {
+    auto error = absl::get<std::string>(print_pages_params);
+    promise.RejectWithErrorMessage("Invalid print parameters: " + error);
+    return;
+  }
+
+  auto* manager = PrintViewManagerElectron::FromWebContents(web_contents);
+  if (!manager) {
+    promise.RejectWithErrorMessage("Failed to find print manager");
+    return;
+  }
+
+  auto params = std::move(
+      absl::get<printing::mojom::PrintPagesParamsPtr>(print_pages_params));
+  params->params->document_cookie = unique_id.value_or(0);
+
+  manager->PrintToPdf(
+      rfh, page_ranges, std::move(params),
+      base::BindOnce(std::move(on_created), std::move(promise)));
+}
 }  // namespace
 
 void WebContents::Print(gin::Arguments* args) {
@@ -3195,63 +3332,23 @@ void WebContents::Print(gin::Arguments* args) {
                      std::move(settings), std::move(callback)));
 }
 
-// Partially duplicated and modified from
-// headless/lib/browser/protocol/page_handler.cc;l=41
 v8::Local<v8::Promise> WebContents::PrintToPDF(const base::Value& settings) {
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
+  StartPrintToPDF(web_contents(), settings, std::move(promise),
+                  base::BindOnce(&OnPDFCreated));
+  return handle;
+}
 
-  // This allows us to track headless printing calls.
-  auto unique_id = settings.GetDict().FindInt(printing::kPreviewRequestID);
-  auto landscape = settings.GetDict().FindBool("landscape");
-  auto display_header_footer =
-      settings.GetDict().FindBool("displayHeaderFooter");
-  auto print_background = settings.GetDict().FindBool("printBackground");
-  auto scale = settings.GetDict().FindDouble("scale");
-  auto paper_width = settings.GetDict().FindDouble("paperWidth");
-  auto paper_height = settings.GetDict().FindDouble("paperHeight");
-  auto margin_top = settings.GetDict().FindDouble("marginTop");
-  auto margin_bottom = settings.GetDict().FindDouble("marginBottom");
-  auto margin_left = settings.GetDict().FindDouble("marginLeft");
-  auto margin_right = settings.GetDict().FindDouble("marginRight");
-  auto page_ranges = *settings.GetDict().FindString("pageRanges");
-  auto header_template = *settings.GetDict().FindString("headerTemplate");
-  auto footer_template = *settings.GetDict().FindString("footerTemplate");
-  auto prefer_css_page_size = settings.GetDict().FindBool("preferCSSPageSize");
-  auto generate_tagged_pdf = settings.GetDict().FindBool("generateTaggedPDF");
-  auto generate_document_outline =
-      settings.GetDict().FindBool("generateDocumentOutline");
-
-  content::RenderFrameHost* rfh = GetRenderFrameHostToUse(web_contents());
-  absl::variant<printing::mojom::PrintPagesParamsPtr, std::string>
-      print_pages_params = print_to_pdf::GetPrintPagesParams(
-          rfh->GetLastCommittedURL(), landscape, display_header_footer,
-          print_background, scale, paper_width, paper_height, margin_top,
-          margin_bottom, margin_left, margin_right,
-          std::make_optional(header_template),
-          std::make_optional(footer_template), prefer_css_page_size,
-          generate_tagged_pdf, generate_document_outline);
-
-  if (absl::holds_alternative<std::string>(print_pages_params)) {
-    auto error = absl::get<std::string>(print_pages_params);
-    promise.RejectWithErrorMessage("Invalid print parameters: " + error);
-    return handle;
-  }
-
-  auto* manager = PrintViewManagerElectron::FromWebContents(web_contents());
-  if (!manager) {
-    promise.RejectWithErrorMessage("Failed to find print manager");
-    return handle;
-  }
-
-  auto params = std::move(
-      absl::get<printing::mojom::PrintPagesParamsPtr>(print_pages_params));
-  params->params->document_cookie = unique_id.value_or(0);
-
-  manager->PrintToPdf(rfh, page_ranges, std::move(params),
-                      base::BindOnce(&OnPDFCreated, std::move(promise)));
-
+v8::Local<v8::Promise> WebContents::PrintToPDFFile(
+    const base::FilePath& path,
+    const base::Value& settings) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  StartPrintToPDF(web_contents(), settings, std::move(promise),
+                  base::BindOnce(&OnPDFCreatedForFile, path));
   return handle;
 }
 #endif
@@ -3919,10 +4016,21 @@ v8::Local<v8::Promise> WebContents::GetProcessMemoryInfo(v8::Isolate* isolate) {
 
 v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
     v8::Isolate* isolate,
-    const base::FilePath& file_path) {
+    const base::FilePath& file_path,
+    gin::Arguments* args) {
   gin_helper::Promise<void> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
+  auto compression = mojom::HeapSnapshotCompression::kNone;
+  if (gin_helper::Dictionary options; args->GetNext(&options)) {
+    if (options.Has("compression") &&
+        !options.Get("compression", &compression)) {
+      promise.RejectWithErrorMessage(
+          "Invalid compression, must be one of 'none' or 'gzip'");
+      return handle;
+    }
+  }
+
   ScopedAllowBlockingForElectron allow_blocking;
   uint32_t flags = base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE;
   // The snapshot file is passed to an untrusted process.
@@ -3939,29 +4047,20 @@ v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
     return handle;
   }
 
-  auto* frame_host = web_contents()->GetPrimaryMainFrame();
-  if (!frame_host) {
-    promise.RejectWithErrorMessage(
-        "Failed to take heap snapshot with invalid webContents main frame");
-    return handle;
-  }
-
-  if (!frame_host->IsRenderFrameLive()) {
-    promise.RejectWithErrorMessage(
-        "Failed to take heap snapshot with nonexistent render frame");
-    return handle;
-  }
-
   // This dance with `base::Owned` is to ensure that the interface stays alive
   // until the callback is called. Otherwise it would be closed at the end of
   // this function.
-  auto electron_renderer =
-      std::make_unique<mojo::Remote<mojom::ElectronRenderer>>();
-  frame_host->GetRemoteInterfaces()->GetInterface(
-      electron_renderer->BindNewPipeAndPassReceiver());
+  std::string_view error;
+  auto electron_renderer = BindMainFrameRenderer(web_contents(), &error);
+  if (!electron_renderer) {
+    promise.RejectWithErrorMessage(
+        base::StrCat({"Failed to take heap snapshot with ", error}));
+    return handle;
+  }
   auto* raw_ptr = electron_renderer.get();
   (*raw_ptr)->TakeHeapSnapshot(
       mojo::WrapPlatformFile(base::ScopedPlatformFile(file.TakePlatformFile())),
+      compression,
       base::BindOnce(
           [](mojo::Remote<mojom::ElectronRenderer>* ep,
              gin_helper::Promise<void> promise, bool success) {
@@ -3975,6 +4074,40 @@ v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
   return handle;
 }
 
+v8::Local<v8::Promise> WebContents::GetHeapSnapshotSummary(
+    v8::Isolate* isolate) {
+  gin_helper::Promise<std::vector<v8::Local<v8::Value>>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  std::string_view error;
+  auto electron_renderer = BindMainFrameRenderer(web_contents(), &error);
+  if (!electron_renderer) {
+    promise.RejectWithErrorMessage(
+        base::StrCat({"Failed to get heap snapshot summary with ", error}));
+    return handle;
+  }
+  auto* raw_ptr = electron_renderer.get();
+  (*raw_ptr)->GetHeapSnapshotSummary(base::BindOnce(
+      [](mojo::Remote<mojom::ElectronRenderer>* ep,
+         gin_helper::Promise<std::vector<v8::Local<v8::Value>>> promise,
+         std::vector<mojom::HeapSnapshotSummaryEntryPtr> entries) {
+        v8::Isolate* isolate = promise.isolate();
+        v8::HandleScope handle_scope(isolate);
+        std::vector<v8::Local<v8::Value>> result;
+        result.reserve(entries.size());
+        for (const auto& entry : entries) {
+          result.push_back(gin::DataObjectBuilder(isolate)
+                               .Set("name", entry->name)
+                               .Set("count", entry->count)
+                               .Set("selfSize", entry->self_size)
+                               .Build());
+        }
+        promise.Resolve(result);
+      },
+      base::Owned(std::move(electron_renderer)), std::move(promise)));
+  return handle;
+}
+
 void WebContents::UpdatePreferredSize(content::WebContents* web_contents,
                                       const gfx::Size& pref_size) {
   Emit("preferred-size-changed", pref_size);
@@ -4499,6 +4632,7 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
 #if BUILDFLAG(ENABLE_PRINTING)
       .SetMethod("_print", &WebContents::Print)
       .SetMethod("_printToPDF", &WebContents::PrintToPDF)
+      .SetMethod("_printToPDFFile", &WebContents::PrintToPDFFile)
 #endif
       .SetMethod("_setNextChildWebPreferences",
                  &WebContents::SetNextChildWebPreferences)
@@ -4519,6 +4653,7 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
                  &WebContents::GetWebRTCIPHandlingPolicy)
       .SetMethod("getWebRTCUDPPortRange", &WebContents::GetWebRTCUDPPortRange)
       .SetMethod("takeHeapSnapshot", &WebContents::TakeHeapSnapshot)
+      .SetMethod("getHeapSnapshotSummary", &WebContents::GetHeapSnapshotSummary)
       .SetMethod("setImageAnimationPolicy",
                  &WebContents::SetImageAnimationPolicy)
       .SetMethod("_getProcessMemoryInfo", &WebContents::GetProcessMemoryInfo)
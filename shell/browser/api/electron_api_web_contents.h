@@ -259,6 +259,9 @@ class WebContents final : public ExclusiveAccessContext,
   void Print(gin::Arguments* args);
   // Print current page as PDF.
   v8::Local<v8::Promise> PrintToPDF(const base::Value& settings);
+  // Print current page as PDF straight to a file.
+  v8::Local<v8::Promise> PrintToPDFFile(const base::FilePath& path,
+                                        const base::Value& settings);
 #endif
 
   void SetNextChildWebPreferences(const gin_helper::Dictionary);
@@ -358,7 +361,9 @@ class WebContents final : public ExclusiveAccessContext,
   void NotifyUserActivation();
 
   v8::Local<v8::Promise> TakeHeapSnapshot(v8::Isolate* isolate,
-                                          const base::FilePath& file_path);
+                                          const base::FilePath& file_path,
+                                          gin::Arguments* args);
+  v8::Local<v8::Promise> GetHeapSnapshotSummary(v8::Isolate* isolate);
   v8::Local<v8::Promise> GetProcessMemoryInfo(v8::Isolate* isolate);
 
   // content::WebContentsDelegate:
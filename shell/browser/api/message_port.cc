@@ -64,37 +64,15 @@ void MessagePort::PostMessage(gin::Arguments* args) {
 
   // |message| is any value that can be serialized to StructuredClone.
   v8::Local<v8::Value> message_value;
-  if (args->GetNext(&message_value)) {
-    if (!electron::SerializeV8Value(args->isolate(), message_value,
-                                    &transferable_message)) {
-      // SerializeV8Value sets an exception.
-      return;
-    }
-  }
+  args->GetNext(&message_value);
 
   v8::Local<v8::Value> transferables;
   std::vector<gin_helper::Handle<MessagePort>> wrapped_ports;
-  if (args->GetNext(&transferables)) {
-    std::vector<v8::Local<v8::Value>> wrapped_port_values;
-    if (!gin::ConvertFromV8(args->isolate(), transferables,
-                            &wrapped_port_values)) {
-      thrower.ThrowTypeError("transferables must be an array of MessagePorts");
-      return;
-    }
-
-    for (unsigned i = 0; i < wrapped_port_values.size(); ++i) {
-      if (!gin_helper::IsValidWrappable(wrapped_port_values[i],
-                                        &MessagePort::kWrapperInfo)) {
-        thrower.ThrowTypeError("Port at index " + base::NumberToString(i) +
-                               " is not a valid port");
-        return;
-      }
-    }
-
-    if (!gin::ConvertFromV8(args->isolate(), transferables, &wrapped_ports)) {
-      thrower.ThrowTypeError("Passed an invalid MessagePort");
-      return;
-    }
+  std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+  if (args->GetNext(&transferables) &&
+      !ConvertTransferables(args->isolate(), transferables, &wrapped_ports,
+                            &array_buffers)) {
+    return;
   }
 
   // Make sure we aren't connected to any of the passed-in ports.
@@ -106,6 +84,18 @@ void MessagePort::PostMessage(gin::Arguments* args) {
     }
   }
 
+  // Serializing detaches the transferred ArrayBuffers, so the ports have to
+  // be checked before that.
+  if (!ValidatePorts(args->isolate(), wrapped_ports))
+    return;
+
+  if (!message_value.IsEmpty() &&
+      !electron::SerializeV8Value(args->isolate(), message_value,
+                                  array_buffers, &transferable_message)) {
+    // SerializeV8Value sets an exception.
+    return;
+  }
+
   bool threw_exception = false;
   transferable_message.ports = MessagePort::DisentanglePorts(
       args->isolate(), wrapped_ports, &threw_exception);
@@ -203,13 +193,9 @@ std::vector<gin_helper::Handle<MessagePort>> MessagePort::EntanglePorts(
 }
 
 // static
-std::vector<blink::MessagePortChannel> MessagePort::DisentanglePorts(
+bool MessagePort::ValidatePorts(
     v8::Isolate* isolate,
-    const std::vector<gin_helper::Handle<MessagePort>>& ports,
-    bool* threw_exception) {
-  if (ports.empty())
-    return {};
-
+    const std::vector<gin_helper::Handle<MessagePort>>& ports) {
   absl::flat_hash_set<MessagePort*> visited;
   visited.reserve(ports.size());
 
@@ -227,16 +213,64 @@ std::vector<blink::MessagePortChannel> MessagePort::DisentanglePorts(
         type = "a duplicate";
       gin_helper::ErrorThrower(isolate).ThrowError(
           "Port at index " + base::NumberToString(i) + " is " + type + ".");
-      *threw_exception = true;
-      return {};
+      return false;
     }
     visited.insert(port);
   }
+  return true;
+}
+
+// static
+std::vector<blink::MessagePortChannel> MessagePort::DisentanglePorts(
+    v8::Isolate* isolate,
+    const std::vector<gin_helper::Handle<MessagePort>>& ports,
+    bool* threw_exception) {
+  if (ports.empty())
+    return {};
+
+  if (!ValidatePorts(isolate, ports)) {
+    *threw_exception = true;
+    return {};
+  }
 
   // Passed-in ports passed validity checks, so we can disentangle them.
   return base::ToVector(ports, [](auto& port) { return port->Disentangle(); });
 }
 
+// static
+bool MessagePort::ConvertTransferables(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> transferables,
+    std::vector<gin_helper::Handle<MessagePort>>* ports,
+    std::vector<v8::Local<v8::ArrayBuffer>>* array_buffers) {
+  gin_helper::ErrorThrower thrower(isolate);
+  std::vector<v8::Local<v8::Value>> values;
+  if (!gin::ConvertFromV8(isolate, transferables, &values)) {
+    thrower.ThrowTypeError(
+        "transferables must be an array of MessagePorts and ArrayBuffers");
+    return false;
+  }
+
+  for (unsigned i = 0; i < values.size(); ++i) {
+    if (values[i]->IsArrayBuffer()) {
+      array_buffers->push_back(values[i].As<v8::ArrayBuffer>());
+      continue;
+    }
+    if (!gin_helper::IsValidWrappable(values[i], &MessagePort::kWrapperInfo)) {
+      thrower.ThrowTypeError("Port at index " + base::NumberToString(i) +
+                             " is not a valid port");
+      return false;
+    }
+    gin_helper::Handle<MessagePort> port;
+    if (!gin::ConvertFromV8(isolate, values[i], &port)) {
+      thrower.ThrowTypeError("Passed an invalid MessagePort");
+      return false;
+    }
+    ports->push_back(port);
+  }
+  return true;
+}
+
 void MessagePort::Pin() {
   if (!pinned_.IsEmpty())
     return;
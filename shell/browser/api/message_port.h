@@ -53,11 +53,25 @@ class MessagePort final : public gin_helper::DeprecatedWrappable<MessagePort>,
       v8::Isolate* isolate,
       std::vector<blink::MessagePortChannel> channels);
 
+  // Throws and returns false if any of |ports| is null, neutered or listed
+  // more than once, without touching the others.
+  static bool ValidatePorts(
+      v8::Isolate* isolate,
+      const std::vector<gin_helper::Handle<MessagePort>>& ports);
+
   static std::vector<blink::MessagePortChannel> DisentanglePorts(
       v8::Isolate* isolate,
       const std::vector<gin_helper::Handle<MessagePort>>& ports,
       bool* threw_exception);
 
+  // Splits |transferables|, an array of MessagePorts and ArrayBuffers, into
+  // |ports| and |array_buffers|. Throws and returns false if it isn't one.
+  static bool ConvertTransferables(
+      v8::Isolate* isolate,
+      v8::Local<v8::Value> transferables,
+      std::vector<gin_helper::Handle<MessagePort>>* ports,
+      std::vector<v8::Local<v8::ArrayBuffer>>* array_buffers);
+
   // gin_helper::Wrappable
   static gin::DeprecatedWrapperInfo kWrapperInfo;
   gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
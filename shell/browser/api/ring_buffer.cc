@@ -0,0 +1,273 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/ring_buffer.h"
+
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task/sequenced_task_runner.h"
+#include "gin/arguments.h"
+#include "gin/object_template_builder.h"
+#include "shell/browser/javascript_environment.h"
+#include "shell/common/gin_helper/error_thrower.h"
+#include "shell/common/gin_helper/event_emitter_caller.h"
+#include "shell/common/gin_helper/handle.h"
+#include "shell/common/node_includes.h"
+#include "shell/common/v8_util.h"
+
+namespace electron {
+
+namespace {
+
+template <typename T>
+void Emit(gin_helper::DeprecatedWrappable<T>* wrappable, const char* name) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Object> self;
+  if (wrappable->GetWrapper(isolate).ToLocal(&self))
+    gin_helper::EmitEvent(isolate, self, name);
+}
+
+}  // namespace
+
+gin::DeprecatedWrapperInfo RingBufferWriter::kWrapperInfo = {
+    gin::kEmbedderNativeGin};
+
+// static
+gin_helper::Handle<RingBufferWriter> RingBufferWriter::Create(
+    v8::Isolate* isolate,
+    uint32_t capacity,
+    mojo::ScopedDataPipeConsumerHandle* consumer) {
+  mojo::ScopedDataPipeProducerHandle producer;
+  if (capacity == 0 ||
+      mojo::CreateDataPipe(capacity, producer, *consumer) != MOJO_RESULT_OK) {
+    gin_helper::ErrorThrower(isolate).ThrowRangeError(
+        "Could not create a ring buffer of " + base::NumberToString(capacity) +
+        " bytes");
+    return {};
+  }
+  return gin_helper::CreateHandle(isolate,
+                                  new RingBufferWriter(std::move(producer)));
+}
+
+RingBufferWriter::RingBufferWriter(mojo::ScopedDataPipeProducerHandle producer)
+    : producer_(std::move(producer)),
+      watcher_(FROM_HERE,
+               mojo::SimpleWatcher::ArmingPolicy::MANUAL,
+               base::SequencedTaskRunner::GetCurrentDefault()) {
+  watcher_.Watch(producer_.get(), MOJO_HANDLE_SIGNAL_WRITABLE,
+                 base::BindRepeating(&RingBufferWriter::OnWritable,
+                                     base::Unretained(this)));
+}
+
+RingBufferWriter::~RingBufferWriter() = default;
+
+bool RingBufferWriter::Write(gin::Arguments* args) {
+  v8::Local<v8::Value> data;
+  if (!args->GetNext(&data) ||
+      !(data->IsArrayBuffer() || data->IsArrayBufferView())) {
+    gin_helper::ErrorThrower(args->isolate())
+        .ThrowTypeError("data must be an ArrayBuffer or ArrayBufferView");
+    return false;
+  }
+  base::span<const uint8_t> bytes =
+      data->IsArrayBuffer() ? util::as_byte_span(data.As<v8::ArrayBuffer>())
+                            : util::as_byte_span(data.As<v8::ArrayBufferView>());
+  if (!producer_.is_valid() || closing_)
+    return false;
+
+  // Bytes can only go straight into the ring buffer when none are queued
+  // before them.
+  if (pending_.empty()) {
+    size_t bytes_written = 0;
+    MojoResult result =
+        producer_->WriteData(bytes, MOJO_WRITE_DATA_FLAG_NONE, bytes_written);
+    if (result == MOJO_RESULT_OK) {
+      bytes = bytes.subspan(bytes_written);
+      if (bytes.empty())
+        return true;
+    } else if (result != MOJO_RESULT_SHOULD_WAIT) {
+      // The reader was closed.
+      CloseNow();
+      return false;
+    }
+  }
+  pending_.emplace_back(bytes.begin(), bytes.end());
+  WaitForRoom();
+  return false;
+}
+
+void RingBufferWriter::Close() {
+  if (pending_.empty())
+    CloseNow();
+  else
+    closing_ = true;
+}
+
+void RingBufferWriter::CloseNow() {
+  if (!producer_.is_valid())
+    return;
+  watcher_.Cancel();
+  producer_.reset();
+  pending_.clear();
+  Emit(this, "close");
+}
+
+void RingBufferWriter::WaitForRoom() {
+  if (waiting_)
+    return;
+  waiting_ = true;
+  watcher_.ArmOrNotify();
+}
+
+void RingBufferWriter::OnWritable(MojoResult result) {
+  waiting_ = false;
+  if (result != MOJO_RESULT_OK) {
+    CloseNow();
+    return;
+  }
+  // The pipe is writable as soon as a single byte is free, so write what
+  // fits and keep waiting for the rest.
+  while (!pending_.empty()) {
+    base::span<const uint8_t> bytes =
+        base::span(pending_.front()).subspan(pending_offset_);
+    size_t bytes_written = 0;
+    result =
+        producer_->WriteData(bytes, MOJO_WRITE_DATA_FLAG_NONE, bytes_written);
+    if (result == MOJO_RESULT_SHOULD_WAIT)
+      break;
+    if (result != MOJO_RESULT_OK) {
+      CloseNow();
+      return;
+    }
+    if (bytes_written < bytes.size()) {
+      pending_offset_ += bytes_written;
+      break;
+    }
+    pending_.pop_front();
+    pending_offset_ = 0;
+  }
+  if (!pending_.empty()) {
+    WaitForRoom();
+  } else if (closing_) {
+    CloseNow();
+  } else {
+    Emit(this, "drain");
+  }
+}
+
+gin::ObjectTemplateBuilder RingBufferWriter::GetObjectTemplateBuilder(
+    v8::Isolate* isolate) {
+  return gin_helper::DeprecatedWrappable<
+             RingBufferWriter>::GetObjectTemplateBuilder(isolate)
+      .SetMethod("write", &RingBufferWriter::Write)
+      .SetMethod("close", &RingBufferWriter::Close);
+}
+
+const char* RingBufferWriter::GetTypeName() {
+  return "RingBufferWriter";
+}
+
+void RingBufferWriter::WillBeDestroyed() {
+  ClearWeak();
+}
+
+gin::DeprecatedWrapperInfo RingBufferReader::kWrapperInfo = {
+    gin::kEmbedderNativeGin};
+
+// static
+gin_helper::Handle<RingBufferReader> RingBufferReader::Create(
+    v8::Isolate* isolate,
+    mojo::ScopedDataPipeConsumerHandle consumer) {
+  auto handle = gin_helper::CreateHandle(
+      isolate, new RingBufferReader(std::move(consumer)));
+  handle->pinned_.Reset(isolate, handle.ToV8());
+  return handle;
+}
+
+RingBufferReader::RingBufferReader(mojo::ScopedDataPipeConsumerHandle consumer)
+    : consumer_(std::move(consumer)),
+      watcher_(FROM_HERE,
+               mojo::SimpleWatcher::ArmingPolicy::MANUAL,
+               base::SequencedTaskRunner::GetCurrentDefault()) {
+  watcher_.Watch(consumer_.get(), MOJO_HANDLE_SIGNAL_READABLE,
+                 base::BindRepeating(&RingBufferReader::OnReadable,
+                                     base::Unretained(this)));
+  WaitForData();
+}
+
+RingBufferReader::~RingBufferReader() = default;
+
+size_t RingBufferReader::Read(v8::Local<v8::ArrayBufferView> view) {
+  if (!consumer_.is_valid())
+    return 0;
+  size_t bytes_read = 0;
+  if (consumer_->ReadData(MOJO_READ_DATA_FLAG_NONE, util::as_byte_span(view),
+                          bytes_read) != MOJO_RESULT_OK) {
+    bytes_read = 0;
+  }
+  // Like a stream, the reader is only told about new data once it has read
+  // everything, so that data it leaves for later doesn't wake it up again.
+  if (GetReadableBytes() == 0)
+    WaitForData();
+  return bytes_read;
+}
+
+size_t RingBufferReader::GetReadableBytes() const {
+  if (!consumer_.is_valid())
+    return 0;
+  size_t readable_bytes = 0;
+  if (consumer_->ReadData(MOJO_READ_DATA_FLAG_QUERY, base::span<uint8_t>(),
+                          readable_bytes) != MOJO_RESULT_OK) {
+    return 0;
+  }
+  return readable_bytes;
+}
+
+void RingBufferReader::Close() {
+  if (!consumer_.is_valid())
+    return;
+  watcher_.Cancel();
+  consumer_.reset();
+  Emit(this, "close");
+  pinned_.Reset();
+}
+
+void RingBufferReader::WaitForData() {
+  if (waiting_ || !consumer_.is_valid())
+    return;
+  waiting_ = true;
+  watcher_.ArmOrNotify();
+}
+
+void RingBufferReader::OnReadable(MojoResult result) {
+  waiting_ = false;
+  if (result != MOJO_RESULT_OK) {
+    // The writer was closed and everything it wrote has been read.
+    Close();
+    return;
+  }
+  Emit(this, "readable");
+}
+
+gin::ObjectTemplateBuilder RingBufferReader::GetObjectTemplateBuilder(
+    v8::Isolate* isolate) {
+  return gin_helper::DeprecatedWrappable<
+             RingBufferReader>::GetObjectTemplateBuilder(isolate)
+      .SetMethod("read", &RingBufferReader::Read)
+      .SetProperty("readableBytes", &RingBufferReader::GetReadableBytes)
+      .SetMethod("close", &RingBufferReader::Close);
+}
+
+const char* RingBufferReader::GetTypeName() {
+  return "RingBufferReader";
+}
+
+void RingBufferReader::WillBeDestroyed() {
+  ClearWeak();
+}
+
+}  // namespace electron
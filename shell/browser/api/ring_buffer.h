@@ -0,0 +1,131 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_RING_BUFFER_H_
+#define ELECTRON_SHELL_BROWSER_API_RING_BUFFER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "base/containers/circular_deque.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/simple_watcher.h"
+#include "shell/common/gin_helper/cleaned_up_at_exit.h"
+#include "shell/common/gin_helper/wrappable.h"
+#include "v8/include/v8-forward.h"
+
+namespace gin {
+class Arguments;
+}  // namespace gin
+
+namespace gin_helper {
+template <typename T>
+class Handle;
+}  // namespace gin_helper
+
+namespace electron {
+
+// The ends of a ring buffer shared between the main process and a utility
+// process, so that a stream of bytes can be sent without a message and a JS
+// event for each write. The ring buffer is a Mojo data pipe: its contents
+// live in shared memory, and the reader is only woken up when it has data to
+// read after running dry.
+class RingBufferWriter final
+    : public gin_helper::DeprecatedWrappable<RingBufferWriter>,
+      public gin_helper::CleanedUpAtExit {
+ public:
+  // Creates a ring buffer of |capacity| bytes and returns its writing end,
+  // setting |consumer| to its reading end. Throws and returns an empty handle
+  // if it can't be created.
+  static gin_helper::Handle<RingBufferWriter> Create(
+      v8::Isolate* isolate,
+      uint32_t capacity,
+      mojo::ScopedDataPipeConsumerHandle* consumer);
+
+  // disable copy
+  RingBufferWriter(const RingBufferWriter&) = delete;
+  RingBufferWriter& operator=(const RingBufferWriter&) = delete;
+
+  // gin_helper::Wrappable
+  static gin::DeprecatedWrapperInfo kWrapperInfo;
+  gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
+      v8::Isolate* isolate) override;
+  const char* GetTypeName() override;
+
+  // gin_helper::CleanedUpAtExit
+  void WillBeDestroyed() override;
+
+ private:
+  explicit RingBufferWriter(mojo::ScopedDataPipeProducerHandle producer);
+  ~RingBufferWriter() override;
+
+  // Writes the bytes of an ArrayBuffer or ArrayBufferView. The bytes that
+  // don't fit are queued, in which case false is returned and 'drain' is
+  // emitted once the queue has been written.
+  bool Write(gin::Arguments* args);
+  // Closes the writing end once the queued bytes have been written.
+  void Close();
+
+  void CloseNow();
+  void WaitForRoom();
+  void OnWritable(MojoResult result);
+
+  mojo::ScopedDataPipeProducerHandle producer_;
+  mojo::SimpleWatcher watcher_;
+  bool waiting_ = false;
+  bool closing_ = false;
+
+  // The bytes that didn't fit yet, and how many of the first chunk's bytes
+  // have been written.
+  base::circular_deque<std::vector<uint8_t>> pending_;
+  size_t pending_offset_ = 0;
+};
+
+class RingBufferReader final
+    : public gin_helper::DeprecatedWrappable<RingBufferReader>,
+      public gin_helper::CleanedUpAtExit {
+ public:
+  static gin_helper::Handle<RingBufferReader> Create(
+      v8::Isolate* isolate,
+      mojo::ScopedDataPipeConsumerHandle consumer);
+
+  // disable copy
+  RingBufferReader(const RingBufferReader&) = delete;
+  RingBufferReader& operator=(const RingBufferReader&) = delete;
+
+  // gin_helper::Wrappable
+  static gin::DeprecatedWrapperInfo kWrapperInfo;
+  gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
+      v8::Isolate* isolate) override;
+  const char* GetTypeName() override;
+
+  // gin_helper::CleanedUpAtExit
+  void WillBeDestroyed() override;
+
+ private:
+  explicit RingBufferReader(mojo::ScopedDataPipeConsumerHandle consumer);
+  ~RingBufferReader() override;
+
+  // Copies as many bytes as are available, up to the size of |view|, into
+  // |view| and returns how many were copied. 'readable' is emitted again
+  // once there is more to read after this empties the ring buffer.
+  size_t Read(v8::Local<v8::ArrayBufferView> view);
+  size_t GetReadableBytes() const;
+  void Close();
+
+  void WaitForData();
+  void OnReadable(MojoResult result);
+
+  mojo::ScopedDataPipeConsumerHandle consumer_;
+  mojo::SimpleWatcher watcher_;
+  bool waiting_ = false;
+
+  // Keeps the reader alive while it is open, since it is typically only
+  // referenced by its own 'readable' listener.
+  v8::Global<v8::Value> pinned_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_API_RING_BUFFER_H_
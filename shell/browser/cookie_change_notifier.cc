@@ -31,6 +31,13 @@ CookieChangeNotifier::RegisterCookieChangeCallback(
   return cookie_change_sub_list_.Add(cb);
 }
 
+base::CallbackListSubscription CookieChangeNotifier::RegisterReconnectCallback(
+    const base::RepeatingClosure& cb) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+
+  return reconnect_callbacks_.Add(cb);
+}
+
 void CookieChangeNotifier::StartListening() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   DCHECK(!receiver_.is_bound());
@@ -54,6 +61,7 @@ void CookieChangeNotifier::OnConnectionError() {
 
   receiver_.reset();
   StartListening();
+  reconnect_callbacks_.Notify();
 }
 
 void CookieChangeNotifier::OnCookieChange(const net::CookieChangeInfo& change) {
@@ -34,6 +34,11 @@ class CookieChangeNotifier : private network::mojom::CookieChangeListener {
       const base::RepeatingCallback<void(const net::CookieChangeInfo& change)>&
           cb);
 
+  // Register callbacks to run after the listener has reconnected to a
+  // restarted network service. Changes made in between aren't notified.
+  base::CallbackListSubscription RegisterReconnectCallback(
+      const base::RepeatingClosure& cb);
+
  private:
   void StartListening();
   void OnConnectionError();
@@ -44,6 +49,7 @@ class CookieChangeNotifier : private network::mojom::CookieChangeListener {
   raw_ptr<ElectronBrowserContext> browser_context_;
   base::RepeatingCallbackList<void(const net::CookieChangeInfo& change)>
       cookie_change_sub_list_;
+  base::RepeatingClosureList reconnect_callbacks_;
 
   mojo::Receiver<network::mojom::CookieChangeListener> receiver_;
 };
@@ -0,0 +1,326 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/cookie_mirror.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+
+#include "base/containers/flat_set.h"
+#include "base/functional/bind.h"
+#include "base/strings/strcat.h"
+#include "base/time/time.h"
+#include "content/public/browser/browser_thread.h"
+#include "content/public/browser/storage_partition.h"
+#include "net/cookies/cookie_change_dispatcher.h"
+#include "services/network/public/cpp/is_potentially_trustworthy.h"
+#include "services/network/public/mojom/cookie_manager.mojom.h"
+#include "shell/browser/cookie_change_notifier.h"
+#include "shell/browser/electron_browser_context.h"
+#include "url/gurl.h"
+
+namespace electron {
+
+namespace {
+
+// Returns the domains of the cookies that can match |host|: host-only
+// cookies for |host| itself and domain cookies for it and each of its parent
+// domains.
+base::flat_set<std::string> DomainsMatching(std::string_view host) {
+  std::vector<std::string> domains = {std::string(host)};
+  for (size_t pos = 0; pos != std::string_view::npos;) {
+    const std::string_view suffix = host.substr(pos);
+    if (!suffix.empty() && suffix.front() != '.')
+      domains.push_back(base::StrCat({".", suffix}));
+    pos = host.find('.', pos);
+    if (pos != std::string_view::npos)
+      ++pos;
+  }
+  return base::flat_set<std::string>(std::move(domains));
+}
+
+// Returns whether |cookie| would be sent to |url|, ignoring SameSite.
+bool MatchesURL(const GURL& url, const net::CanonicalCookie& cookie) {
+  return cookie.IsDomainMatch(url.host()) && cookie.IsOnPath(url.path()) &&
+         (!cookie.SecureAttribute() ||
+          network::IsUrlPotentiallyTrustworthy(url));
+}
+
+// Returns whether |change| is the notification of setting |cookie|, or of
+// removing it if |removed|. Values are compared rather than creation dates,
+// which the network service keeps from the cookie a set overwrites if its
+// value is unchanged.
+bool IsNotificationOf(const net::CookieChangeInfo& change,
+                      const net::CanonicalCookie& cookie,
+                      bool removed) {
+  if (removed) {
+    return change.cause == net::CookieChangeCause::EXPLICIT &&
+           change.cookie.Value() == cookie.Value();
+  }
+  return change.cause == net::CookieChangeCause::INSERTED &&
+         change.cookie.Value() == cookie.Value() &&
+         change.cookie.ExpiryDate() == cookie.ExpiryDate();
+}
+
+// The order CookieMonster returns cookies in: longest path first, then
+// oldest first.
+bool CookieOrder(const net::CanonicalCookie& a, const net::CanonicalCookie& b) {
+  if (a.Path().size() != b.Path().size())
+    return a.Path().size() > b.Path().size();
+  return a.CreationDate() < b.CreationDate();
+}
+
+}  // namespace
+
+CookieMirror::CookieMirror(ElectronBrowserContext* browser_context)
+    : browser_context_(browser_context) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  // Listen first so that no change made while loading is missed.
+  CookieChangeNotifier* notifier = browser_context_->cookie_change_notifier();
+  cookie_change_subscription_ =
+      notifier->RegisterCookieChangeCallback(base::BindRepeating(
+          &CookieMirror::OnCookieChanged, base::Unretained(this)));
+  // Changes made while the network service was gone were never notified.
+  reconnect_subscription_ = notifier->RegisterReconnectCallback(
+      base::BindRepeating(&CookieMirror::Load, base::Unretained(this)));
+  Load();
+}
+
+CookieMirror::~CookieMirror() = default;
+
+// static
+bool CookieMirror::MatchesFilter(const base::Value::Dict& filter,
+                                 const net::CanonicalCookie& cookie) {
+  const std::string* str;
+  if ((str = filter.FindString("name")) && *str != cookie.Name())
+    return false;
+  if ((str = filter.FindString("path")) && *str != cookie.Path())
+    return false;
+  if ((str = filter.FindString("domain")) && !cookie.IsDomainMatch(*str))
+    return false;
+  std::optional<bool> secure_filter = filter.FindBool("secure");
+  if (secure_filter && *secure_filter != cookie.SecureAttribute())
+    return false;
+  std::optional<bool> session_filter = filter.FindBool("session");
+  if (session_filter && *session_filter == cookie.IsPersistent())
+    return false;
+  std::optional<bool> httpOnly_filter = filter.FindBool("httpOnly");
+  if (httpOnly_filter && *httpOnly_filter != cookie.IsHttpOnly())
+    return false;
+  return true;
+}
+
+void CookieMirror::Query(base::Value::Dict filter, QueryCallback callback) {
+  if (!loaded_) {
+    pending_queries_.emplace_back(std::move(filter), std::move(callback));
+    return;
+  }
+  std::move(callback).Run(Find(filter));
+}
+
+void CookieMirror::OnCookieSet(const net::CanonicalCookie& cookie) {
+  ApplyWhenLoaded(
+      base::BindOnce(&CookieMirror::ApplySet, base::Unretained(this), cookie));
+}
+
+void CookieMirror::OnCookiesRemoved(const GURL& url, const std::string& name) {
+  ApplyWhenLoaded(base::BindOnce(&CookieMirror::ApplyRemoval,
+                                 base::Unretained(this), url, name));
+}
+
+base::WeakPtr<CookieMirror> CookieMirror::GetWeakPtr() {
+  return weak_factory_.GetWeakPtr();
+}
+
+void CookieMirror::Load() {
+  loaded_ = false;
+  auto* manager = browser_context_->GetDefaultStoragePartition()
+                      ->GetCookieManagerForBrowserProcess();
+  manager->GetAllCookies(base::BindOnce(
+      &CookieMirror::OnLoaded, weak_factory_.GetWeakPtr(), ++generation_));
+}
+
+void CookieMirror::OnLoaded(int generation, const net::CookieList& cookies) {
+  // A newer load replaced this one.
+  if (generation != generation_)
+    return;
+
+  cookies_.clear();
+  by_domain_.clear();
+  by_name_.clear();
+  by_path_.clear();
+  // Notifications lost while the network service was gone never arrive.
+  unconfirmed_writes_.clear();
+  for (const auto& cookie : cookies)
+    Insert(cookie);
+
+  // Changes notified while loading may or may not be part of |cookies|
+  // already. Each one sets or removes a single cookie, so replaying them in
+  // order ends in the same state either way.
+  for (auto& change : std::exchange(pending_changes_, {}))
+    std::move(change).Run();
+  loaded_ = true;
+
+  for (auto& [filter, callback] : std::exchange(pending_queries_, {}))
+    std::move(callback).Run(Find(filter));
+}
+
+void CookieMirror::OnCookieChanged(const net::CookieChangeInfo& change) {
+  ApplyWhenLoaded(base::BindOnce(&CookieMirror::ApplyNotification,
+                                 base::Unretained(this), change));
+}
+
+void CookieMirror::ApplyWhenLoaded(base::OnceClosure change) {
+  if (loaded_)
+    std::move(change).Run();
+  else
+    pending_changes_.push_back(std::move(change));
+}
+
+void CookieMirror::ApplyNotification(const net::CookieChangeInfo& change) {
+  const Key key = change.cookie.UniqueKey();
+  auto it = unconfirmed_writes_.find(key);
+  if (it != unconfirmed_writes_.end()) {
+    // Notifications arrive in the order the network service made the
+    // changes, so one that isn't for an unconfirmed write predates them all,
+    // like the deletion of the cookie a set overwrote. The mirror already
+    // shows a later state, so ignore it.
+    auto& writes = it->second;
+    auto confirmed = std::ranges::find_if(writes, [&](const auto& write) {
+      return IsNotificationOf(change, write.cookie, write.removed);
+    });
+    if (confirmed == writes.end())
+      return;
+    writes.erase(writes.begin(), std::next(confirmed));
+    // Later writes are already shown too.
+    if (!writes.empty())
+      return;
+    unconfirmed_writes_.erase(it);
+  }
+
+  if (net::CookieChangeCauseIsDeletion(change.cause))
+    EraseKey(key);
+  else
+    Insert(change.cookie);
+}
+
+void CookieMirror::ApplySet(const net::CanonicalCookie& cookie) {
+  unconfirmed_writes_[cookie.UniqueKey()].push_back(
+      {.removed = false, .cookie = cookie});
+  Insert(cookie);
+}
+
+void CookieMirror::ApplyRemoval(const GURL& url, const std::string& name) {
+  auto it = by_name_.find(name);
+  if (it == by_name_.end())
+    return;
+  std::vector<Key> removed;
+  for (const Key& key : it->second) {
+    const net::CanonicalCookie& cookie = cookies_.at(key);
+    // Be stricter than the network service about Secure cookies, which it
+    // may also delete for trustworthy http: URLs, so that a cookie it kept is
+    // never dropped. Any others are dropped by their notification.
+    if (cookie.IsDomainMatch(url.host()) && cookie.IsOnPath(url.path()) &&
+        (!cookie.SecureAttribute() || url.SchemeIsCryptographic()))
+      removed.push_back(key);
+  }
+  for (const Key& key : removed) {
+    unconfirmed_writes_[key].push_back(
+        {.removed = true, .cookie = cookies_.at(key)});
+    EraseKey(key);
+  }
+}
+
+void CookieMirror::Insert(const net::CanonicalCookie& cookie) {
+  const Key key = cookie.UniqueKey();
+  auto [it, inserted] = cookies_.insert_or_assign(key, cookie);
+  if (!inserted)
+    return;
+  by_domain_[cookie.Domain()].insert(key);
+  by_name_[cookie.Name()].insert(key);
+  by_path_[cookie.Path()].insert(key);
+}
+
+void CookieMirror::EraseKey(const Key& key) {
+  auto it = cookies_.find(key);
+  if (it == cookies_.end())
+    return;
+  const net::CanonicalCookie& cookie = it->second;
+  for (auto [index, value] :
+       {std::pair{&by_domain_, &cookie.Domain()},
+        std::pair{&by_name_, &cookie.Name()},
+        std::pair{&by_path_, &cookie.Path()}}) {
+    auto entry = index->find(*value);
+    entry->second.erase(key);
+    if (entry->second.empty())
+      index->erase(entry);
+  }
+  cookies_.erase(it);
+}
+
+net::CookieList CookieMirror::Find(const base::Value::Dict& filter) const {
+  GURL url;
+  if (const std::string* url_string = filter.FindString("url");
+      url_string && !url_string->empty()) {
+    url = GURL(*url_string);
+    if (!url.is_valid())
+      return {};
+  }
+
+  // Only look at the cookies in the smallest matching part of an index.
+  std::vector<const std::set<Key>*> candidates;
+  bool narrowed = false;
+  size_t candidate_count = 0;
+  auto narrow = [&](const Index& index, const auto& values) {
+    std::vector<const std::set<Key>*> sets;
+    size_t count = 0;
+    for (const std::string& value : values) {
+      auto it = index.find(value);
+      if (it != index.end()) {
+        sets.push_back(&it->second);
+        count += it->second.size();
+      }
+    }
+    if (!narrowed || count < candidate_count) {
+      candidates = std::move(sets);
+      candidate_count = count;
+      narrowed = true;
+    }
+  };
+  if (const std::string* name = filter.FindString("name"))
+    narrow(by_name_, std::set<std::string>{*name});
+  if (const std::string* path = filter.FindString("path"))
+    narrow(by_path_, std::set<std::string>{*path});
+  if (const std::string* domain = filter.FindString("domain"))
+    narrow(by_domain_, DomainsMatching(*domain));
+  if (url.is_valid())
+    narrow(by_domain_, DomainsMatching(url.host()));
+
+  const base::Time now = base::Time::Now();
+  net::CookieList result;
+  // Like cookies.get(), which only asks for partitioned cookies when it
+  // lists every cookie rather than the ones sent to a url.
+  auto add_if_matching = [&](const net::CanonicalCookie& cookie) {
+    if (!cookie.IsExpired(now) && MatchesFilter(filter, cookie) &&
+        (!url.is_valid() ||
+         (!cookie.IsPartitioned() && MatchesURL(url, cookie))))
+      result.push_back(cookie);
+  };
+  if (narrowed) {
+    for (const std::set<Key>* keys : candidates) {
+      for (const Key& key : *keys)
+        add_if_matching(cookies_.at(key));
+    }
+  } else {
+    for (const auto& [key, cookie] : cookies_)
+      add_if_matching(cookie);
+  }
+
+  std::ranges::stable_sort(result, &CookieOrder);
+  return result;
+}
+
+}  // namespace electron
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_COOKIE_MIRROR_H_
+#define ELECTRON_SHELL_BROWSER_COOKIE_MIRROR_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback_list.h"
+#include "base/containers/circular_deque.h"
+#include "base/functional/callback.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/values.h"
+#include "net/cookies/canonical_cookie.h"
+
+class GURL;
+
+namespace net {
+struct CookieChangeInfo;
+}  // namespace net
+
+namespace electron {
+
+class ElectronBrowserContext;
+
+// A copy of a browser context's cookies kept in the browser process, so that
+// filtered queries don't need a round trip to the network service. It is
+// loaded once and then kept current through CookieChangeNotifier, which means
+// that changes made by the network service and renderers show up once their
+// notification arrives rather than immediately. The cookies are indexed by
+// domain, name and path.
+class CookieMirror {
+ public:
+  using QueryCallback = base::OnceCallback<void(const net::CookieList&)>;
+
+  explicit CookieMirror(ElectronBrowserContext* browser_context);
+  ~CookieMirror();
+
+  // disable copy
+  CookieMirror(const CookieMirror&) = delete;
+  CookieMirror& operator=(const CookieMirror&) = delete;
+
+  // Returns whether |cookie| matches the name, domain, path, secure, session
+  // and httpOnly keys of |filter|, a cookies.get() filter.
+  static bool MatchesFilter(const base::Value::Dict& filter,
+                            const net::CanonicalCookie& cookie);
+
+  // Runs |callback| with the unexpired cookies matching |filter|, ordered
+  // like CookieManager::GetAllCookies() orders them. A url in |filter| is
+  // matched against the cookies' domain, path and Secure attribute. Queries
+  // made before the cookies have loaded wait for them.
+  void Query(base::Value::Dict filter, QueryCallback callback);
+
+  // Record changes made through the cookies API once they succeed, so that
+  // the next query sees them even if their notification hasn't arrived yet.
+  // Until it does, older notifications for the same cookies are ignored.
+  void OnCookieSet(const net::CanonicalCookie& cookie);
+  void OnCookiesRemoved(const GURL& url, const std::string& name);
+
+  base::WeakPtr<CookieMirror> GetWeakPtr();
+
+ private:
+  using Key = net::CanonicalCookie::UniqueCookieKey;
+  using Index = std::map<std::string, std::set<Key>>;
+
+  // A change made through the cookies API whose notification hasn't arrived
+  // yet.
+  struct UnconfirmedWrite {
+    bool removed = false;
+    net::CanonicalCookie cookie;
+  };
+
+  void Load();
+  void OnLoaded(int generation, const net::CookieList& cookies);
+  void OnCookieChanged(const net::CookieChangeInfo& change);
+
+  // Runs |change| now, or after loading if the cookies are still loading.
+  void ApplyWhenLoaded(base::OnceClosure change);
+
+  void ApplyNotification(const net::CookieChangeInfo& change);
+  void ApplySet(const net::CanonicalCookie& cookie);
+  // Erases the cookies named |name| that CookieManager::DeleteCookies()
+  // deleted for |url|.
+  void ApplyRemoval(const GURL& url, const std::string& name);
+
+  void Insert(const net::CanonicalCookie& cookie);
+  void EraseKey(const Key& key);
+
+  net::CookieList Find(const base::Value::Dict& filter) const;
+
+  // Weak reference; ElectronBrowserContext is guaranteed to outlive us.
+  raw_ptr<ElectronBrowserContext> browser_context_;
+
+  std::map<Key, net::CanonicalCookie> cookies_;
+  Index by_domain_;
+  Index by_name_;
+  Index by_path_;
+
+  // Oldest first, for each cookie with unconfirmed writes.
+  std::map<Key, base::circular_deque<UnconfirmedWrite>> unconfirmed_writes_;
+
+  bool loaded_ = false;
+  int generation_ = 0;
+  std::vector<base::OnceClosure> pending_changes_;
+  std::vector<std::pair<base::Value::Dict, QueryCallback>> pending_queries_;
+
+  base::CallbackListSubscription cookie_change_subscription_;
+  base::CallbackListSubscription reconnect_subscription_;
+
+  base::WeakPtrFactory<CookieMirror> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_COOKIE_MIRROR_H_
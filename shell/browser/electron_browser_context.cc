@@ -17,6 +17,7 @@
 #include "base/no_destructor.h"
 #include "base/path_service.h"
 #include "base/strings/escape.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "chrome/common/chrome_paths.h"
@@ -305,6 +306,39 @@ bool DoesDeviceMatch(const base::Value& device,
   return false;
 }
 
+// Returns the key of |device| in the granted devices of an origin, made of
+// the fields DoesDeviceMatch() requires to be present and equal, or
+// std::nullopt if the device can't match any other.
+std::optional<std::string> GetDeviceKey(
+    const base::Value& device,
+    const blink::PermissionType permission_type) {
+  const base::Value::Dict& dict = device.GetDict();
+  const auto id = [&dict](std::string_view key) {
+    const std::optional<int> value = dict.FindInt(key);
+    return value ? base::NumberToString(*value) : std::string();
+  };
+  if (permission_type == blink::PermissionType::HID ||
+      permission_type == blink::PermissionType::USB) {
+    const auto* serial_number = dict.FindString(kDeviceSerialNumberKey);
+    if (!serial_number)
+      return std::nullopt;
+    return base::StrCat({id(kDeviceVendorIdKey), ":", id(kDeviceProductIdKey),
+                         ":", *serial_number});
+  } else if (permission_type == blink::PermissionType::SERIAL) {
+#if BUILDFLAG(IS_WIN)
+    const auto* instance_id = dict.FindString(kDeviceInstanceIdKey);
+    if (!instance_id)
+      return std::nullopt;
+    return *instance_id;
+#else
+    // Serial numbers and USB driver keys only have to be equal when both
+    // ports have one, so they're left to DoesDeviceMatch().
+    return base::StrCat({id(kVendorIdKey), ":", id(kProductIdKey)});
+#endif  // BUILDFLAG(IS_WIN)
+  }
+  return std::nullopt;
+}
+
 // partition_id => browser_context
 struct PartitionKey {
   PartitionKey(const std::string_view partition, bool in_memory)
@@ -824,8 +858,10 @@ void ElectronBrowserContext::GrantDevicePermission(
     const url::Origin& origin,
     const base::Value& device,
     blink::PermissionType permission_type) {
-  granted_devices_[permission_type][origin].push_back(
-      std::make_unique<base::Value>(device.Clone()));
+  std::optional<std::string> key = GetDeviceKey(device, permission_type);
+  if (!key)
+    return;
+  granted_devices_[permission_type][origin][*key].push_back(device.Clone());
 }
 
 void ElectronBrowserContext::RevokeDevicePermission(
@@ -840,10 +876,20 @@ void ElectronBrowserContext::RevokeDevicePermission(
   if (origin_devices_it == current_devices_it->second.end())
     return;
 
-  std::erase_if(origin_devices_it->second,
+  std::optional<std::string> key = GetDeviceKey(device, permission_type);
+  if (!key)
+    return;
+  GrantedDevices& granted = origin_devices_it->second;
+  auto devices_it = granted.find(*key);
+  if (devices_it == granted.end())
+    return;
+
+  std::erase_if(devices_it->second,
                 [&device, &permission_type](auto const& val) {
-                  return DoesDeviceMatch(device, *val, permission_type);
+                  return DoesDeviceMatch(device, val, permission_type);
                 });
+  if (devices_it->second.empty())
+    granted.erase(devices_it);
 }
 
 bool ElectronBrowserContext::CheckDevicePermission(
@@ -858,12 +904,18 @@ bool ElectronBrowserContext::CheckDevicePermission(
   if (origin_devices_it == current_devices_it->second.end())
     return false;
 
-  for (const auto& device_to_compare : origin_devices_it->second) {
-    if (DoesDeviceMatch(device, *device_to_compare, permission_type))
-      return true;
-  }
+  std::optional<std::string> key = GetDeviceKey(device, permission_type);
+  if (!key)
+    return false;
+  const GrantedDevices& granted = origin_devices_it->second;
+  auto devices_it = granted.find(*key);
+  if (devices_it == granted.end())
+    return false;
 
-  return false;
+  return std::ranges::any_of(
+      devices_it->second, [&device, &permission_type](auto const& val) {
+        return DoesDeviceMatch(device, val, permission_type);
+      });
 }
 
 // static
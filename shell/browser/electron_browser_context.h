@@ -17,6 +17,7 @@
 #include "content/public/browser/media_stream_request.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "services/network/public/mojom/ssl_config.mojom.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
 #include "third_party/blink/public/common/permissions/permission_utils.h"
 
 class PrefService;
@@ -161,9 +162,12 @@ class ElectronBrowserContext : public content::BrowserContext {
                              blink::PermissionType permissionType);
 
  private:
-  using DevicePermissionMap = std::map<
-      blink::PermissionType,
-      std::map<url::Origin, std::vector<std::unique_ptr<base::Value>>>>;
+  // The devices granted to an origin, keyed by the fields that identify them
+  // so that a check only compares the device with those that can match.
+  using GrantedDevices =
+      absl::flat_hash_map<std::string, std::vector<base::Value>>;
+  using DevicePermissionMap =
+      std::map<blink::PermissionType, std::map<url::Origin, GrantedDevices>>;
 
   using PartitionOrPath =
       std::variant<std::reference_wrapper<const std::string>,
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "base/containers/to_vector.h"
+#include "base/json/json_writer.h"
 #include "base/values.h"
 #include "content/browser/permissions/permission_util.h"  // nogncheck
 #include "content/public/browser/child_process_security_policy.h"
@@ -36,6 +37,9 @@ namespace electron {
 
 namespace {
 
+// Enough for every permission of a few hundred origins.
+constexpr size_t kMaxCachedChecks = 1000;
+
 bool WebContentsDestroyed(content::RenderFrameHost* rfh) {
   content::WebContents* web_contents =
       content::WebContents::FromRenderFrameHost(rfh);
@@ -104,7 +108,8 @@ class ElectronPermissionManager::PendingRequest {
   size_t remaining_results_;
 };
 
-ElectronPermissionManager::ElectronPermissionManager() = default;
+ElectronPermissionManager::ElectronPermissionManager()
+    : check_cache_(kMaxCachedChecks) {}
 
 ElectronPermissionManager::~ElectronPermissionManager() = default;
 
@@ -125,6 +130,7 @@ void ElectronPermissionManager::SetPermissionRequestHandler(
 void ElectronPermissionManager::SetPermissionCheckHandler(
     const CheckHandler& handler) {
   check_handler_ = handler;
+  ClearCheckCache();
 }
 
 void ElectronPermissionManager::SetDevicePermissionHandler(
@@ -137,6 +143,17 @@ void ElectronPermissionManager::SetProtectedUSBHandler(
   protected_usb_handler_ = handler;
 }
 
+void ElectronPermissionManager::ClearCheckCache() {
+  check_cache_.Clear();
+}
+
+ElectronPermissionManager::CheckCacheStats
+ElectronPermissionManager::GetCheckCacheStats() const {
+  return {.hits = check_cache_hits_,
+          .misses = check_cache_misses_,
+          .entries = check_cache_.size()};
+}
+
 void ElectronPermissionManager::SetBluetoothPairingHandler(
     const BluetoothPairingHandler& handler) {
   bluetooth_pairing_handler_ = handler;
@@ -250,7 +267,16 @@ void ElectronPermissionManager::OnPermissionResponse(
 void ElectronPermissionManager::ResetPermission(
     blink::PermissionType permission,
     const GURL& requesting_origin,
-    const GURL& embedding_origin) {}
+    const GURL& embedding_origin) {
+  const url::Origin origin = url::Origin::Create(requesting_origin);
+  for (auto it = check_cache_.begin(); it != check_cache_.end();) {
+    if (std::get<0>(it->first) == permission &&
+        std::get<1>(it->first) == origin)
+      it = check_cache_.Erase(it);
+    else
+      ++it;
+  }
+}
 
 void ElectronPermissionManager::RequestPermissionsFromCurrentDocument(
     content::RenderFrameHost* render_frame_host,
@@ -338,8 +364,32 @@ bool ElectronPermissionManager::CheckPermissionWithDetails(
     default:
       break;
   }
-  return check_handler_.Run(web_contents, permission, requesting_origin,
-                            base::Value(std::move(details)));
+
+  // Dicts are sorted by key, so equal details serialize to the same string.
+  // The requesting URL changes on every navigation within an origin, so it is
+  // left out of the key.
+  base::Value::Dict key_details = details.Clone();
+  key_details.Remove("requestingUrl");
+  CheckCacheKey key{permission, url::Origin::Create(requesting_origin),
+                    base::WriteJson(key_details).value_or(std::string())};
+  if (auto it = check_cache_.Get(key); it != check_cache_.end()) {
+    if (it->second.expiry > base::TimeTicks::Now()) {
+      ++check_cache_hits_;
+      return it->second.granted;
+    }
+    check_cache_.Erase(it);
+  }
+  ++check_cache_misses_;
+
+  const CheckResult result = check_handler_.Run(
+      web_contents, permission, requesting_origin,
+      base::Value(std::move(details)));
+  if (result.cache_for.is_positive()) {
+    check_cache_.Put(std::move(key),
+                     {.granted = result.granted,
+                      .expiry = base::TimeTicks::Now() + result.cache_for});
+  }
+  return result.granted;
 }
 
 bool ElectronPermissionManager::CheckDevicePermission(
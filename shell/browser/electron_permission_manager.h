@@ -5,13 +5,19 @@
 #ifndef ELECTRON_SHELL_BROWSER_ELECTRON_PERMISSION_MANAGER_H_
 #define ELECTRON_SHELL_BROWSER_ELECTRON_PERMISSION_MANAGER_H_
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include "base/containers/id_map.h"
+#include "base/containers/lru_cache.h"
 #include "base/functional/callback_forward.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/browser/permission_controller_delegate.h"
+#include "url/origin.h"
 
 namespace content {
 class WebContents;
@@ -52,8 +58,23 @@ class ElectronPermissionManager : public content::PermissionControllerDelegate {
                                                       blink::PermissionType,
                                                       StatusCallback,
                                                       const base::Value&)>;
+  // The decision of the permission check handler. A positive |cache_for|
+  // lets the decision answer later checks of the same permission from the
+  // same requesting origin, embedding origin and kind of frame without
+  // calling the handler again.
+  struct CheckResult {
+    bool granted = false;
+    base::TimeDelta cache_for;
+  };
+
+  struct CheckCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t entries = 0;
+  };
+
   using CheckHandler =
-      base::RepeatingCallback<bool(content::WebContents*,
+      base::RepeatingCallback<CheckResult(content::WebContents*,
                                    blink::PermissionType,
                                    const GURL& requesting_origin,
                                    const base::Value&)>;
@@ -82,6 +103,14 @@ class ElectronPermissionManager : public content::PermissionControllerDelegate {
   void SetProtectedUSBHandler(const ProtectedUSBHandler& handler);
   void SetBluetoothPairingHandler(const BluetoothPairingHandler& handler);
 
+  bool HasDevicePermissionHandler() const {
+    return !device_permission_handler_.is_null();
+  }
+
+  // Forgets the decisions cached from the permission check handler.
+  void ClearCheckCache();
+  CheckCacheStats GetCheckCacheStats() const;
+
   void CheckBluetoothDevicePair(gin_helper::Dictionary details,
                                 PairCallback pair_callback) const;
 
@@ -152,6 +181,16 @@ class ElectronPermissionManager : public content::PermissionControllerDelegate {
   class PendingRequest;
   using PendingRequestsMap = base::IDMap<std::unique_ptr<PendingRequest>>;
 
+  // <permission, requesting origin, details but requestingUrl as canonical
+  // JSON>. The details are part of the key because some checks only name the
+  // origin that asked, like an iframe's, in them.
+  using CheckCacheKey =
+      std::tuple<blink::PermissionType, url::Origin, std::string>;
+  struct CachedCheck {
+    bool granted = false;
+    base::TimeTicks expiry;
+  };
+
   void RequestPermissionsWithDetails(
       content::RenderFrameHost* render_frame_host,
       const content::PermissionRequestDescription& request_description,
@@ -164,6 +203,11 @@ class ElectronPermissionManager : public content::PermissionControllerDelegate {
   ProtectedUSBHandler protected_usb_handler_;
   BluetoothPairingHandler bluetooth_pairing_handler_;
 
+  // Checks are answered from const methods, so the cache is mutable.
+  mutable base::LRUCache<CheckCacheKey, CachedCheck> check_cache_;
+  mutable uint64_t check_cache_hits_ = 0;
+  mutable uint64_t check_cache_misses_ = 0;
+
   PendingRequestsMap pending_requests_;
 };
 
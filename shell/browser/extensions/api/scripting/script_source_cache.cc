@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/extensions/api/scripting/script_source_cache.h"
+
+#include <memory>
+
+#include "base/functional/bind.h"
+#include "base/no_destructor.h"
+#include "base/task/sequenced_task_runner.h"
+#include "extensions/browser/extension_registry_factory.h"
+#include "extensions/browser/extensions_browser_client.h"
+#include "extensions/common/extension.h"
+
+namespace extensions {
+
+ScriptSourceCache::ScriptSourceCache(content::BrowserContext* context)
+    : registry_(ExtensionRegistry::Get(context)) {
+  extension_registry_observation_.Observe(registry_);
+}
+
+ScriptSourceCache::~ScriptSourceCache() = default;
+
+// static
+ScriptSourceCache* ScriptSourceCache::Get(content::BrowserContext* context) {
+  return BrowserContextKeyedAPIFactory<ScriptSourceCache>::Get(context);
+}
+
+// static
+BrowserContextKeyedAPIFactory<ScriptSourceCache>*
+ScriptSourceCache::GetFactoryInstance() {
+  static base::NoDestructor<BrowserContextKeyedAPIFactory<ScriptSourceCache>>
+      instance;
+  return instance.get();
+}
+
+bool ScriptSourceCache::LoadFiles(
+    std::vector<std::string> files,
+    script_parsing::ContentScriptType resources_type,
+    const Extension& extension,
+    bool requires_localization,
+    scripting::ResourcesLoadedCallback callback,
+    std::string* error_out) {
+  if (auto it = sources_.find(extension.id());
+      it != sources_.end() && !files.empty()) {
+    std::vector<scripting::InjectedFileSource> file_sources;
+    for (const auto& file : files) {
+      auto source = it->second.find(Key(resources_type, file));
+      if (source == it->second.end())
+        break;
+      file_sources.emplace_back(file,
+                                std::make_unique<std::string>(source->second));
+    }
+    if (file_sources.size() == files.size()) {
+      base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+          FROM_HERE, base::BindOnce(std::move(callback),
+                                    std::move(file_sources), std::nullopt));
+      return true;
+    }
+  }
+
+  // Load all of the files when some weren't loaded before, which also reports
+  // their errors the way the uncached load does.
+  return scripting::CheckAndLoadFiles(
+      std::move(files), resources_type, extension, requires_localization,
+      base::BindOnce(&ScriptSourceCache::OnFilesLoaded,
+                     weak_factory_.GetWeakPtr(),
+                     base::WrapRefCounted(&extension), resources_type,
+                     std::move(callback)),
+      error_out);
+}
+
+// static
+void ScriptSourceCache::OnFilesLoaded(
+    base::WeakPtr<ScriptSourceCache> cache,
+    scoped_refptr<const Extension> extension,
+    script_parsing::ContentScriptType resources_type,
+    scripting::ResourcesLoadedCallback callback,
+    std::vector<scripting::InjectedFileSource> file_sources,
+    std::optional<std::string> load_error) {
+  // Don't keep the files of an extension that was unloaded, or reloaded,
+  // while they were being read.
+  if (cache && !load_error &&
+      cache->registry_->enabled_extensions().GetByID(extension->id()) ==
+          extension.get()) {
+    Sources& sources = cache->sources_[extension->id()];
+    for (const auto& file_source : file_sources)
+      sources[Key(resources_type, file_source.file_name)] = *file_source.data;
+  }
+  std::move(callback).Run(std::move(file_sources), std::move(load_error));
+}
+
+void ScriptSourceCache::OnExtensionUnloaded(
+    content::BrowserContext* browser_context,
+    const Extension* extension,
+    UnloadedExtensionReason reason) {
+  sources_.erase(extension->id());
+}
+
+template <>
+void BrowserContextKeyedAPIFactory<
+    ScriptSourceCache>::DeclareFactoryDependencies() {
+  DependsOn(ExtensionsBrowserClient::Get()->GetExtensionSystemFactory());
+  DependsOn(ExtensionRegistryFactory::GetInstance());
+}
+
+}  // namespace extensions
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_EXTENSIONS_API_SCRIPTING_SCRIPT_SOURCE_CACHE_H_
+#define ELECTRON_SHELL_BROWSER_EXTENSIONS_API_SCRIPTING_SCRIPT_SOURCE_CACHE_H_
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/scoped_observation.h"
+#include "extensions/browser/browser_context_keyed_api_factory.h"
+#include "extensions/browser/extension_registry.h"
+#include "extensions/browser/extension_registry_observer.h"
+#include "extensions/browser/scripting_utils.h"
+#include "extensions/common/extension_id.h"
+#include "extensions/common/utils/content_script_utils.h"
+
+namespace content {
+class BrowserContext;
+}
+
+namespace extensions {
+
+class Extension;
+
+// Keeps the files loaded for scripting.executeScript() and
+// scripting.insertCSS() file injections, so that injecting the same files
+// again doesn't read them from disk again. The files of an extension are
+// dropped when it is unloaded, which is also how an unpacked extension's
+// edited files are picked up.
+class ScriptSourceCache : public BrowserContextKeyedAPI,
+                          public ExtensionRegistryObserver {
+ public:
+  explicit ScriptSourceCache(content::BrowserContext* context);
+  ~ScriptSourceCache() override;
+
+  // disable copy
+  ScriptSourceCache(const ScriptSourceCache&) = delete;
+  ScriptSourceCache& operator=(const ScriptSourceCache&) = delete;
+
+  static ScriptSourceCache* Get(content::BrowserContext* context);
+
+  static BrowserContextKeyedAPIFactory<ScriptSourceCache>* GetFactoryInstance();
+
+  // Like scripting::CheckAndLoadFiles(), but |callback| is run with the
+  // cached sources when all of |files| were loaded before. It is always run
+  // asynchronously.
+  bool LoadFiles(std::vector<std::string> files,
+                 script_parsing::ContentScriptType resources_type,
+                 const Extension& extension,
+                 bool requires_localization,
+                 scripting::ResourcesLoadedCallback callback,
+                 std::string* error_out);
+
+ private:
+  friend class BrowserContextKeyedAPIFactory<ScriptSourceCache>;
+
+  // The files of an extension, by their type and name. CSS files are
+  // localized, so the same file can be loaded differently as JS and CSS.
+  using Key = std::pair<script_parsing::ContentScriptType, std::string>;
+  using Sources = std::map<Key, std::string>;
+
+  // Keeps the loaded files, if the cache still exists, before passing them
+  // on to |callback|.
+  static void OnFilesLoaded(
+      base::WeakPtr<ScriptSourceCache> cache,
+      scoped_refptr<const Extension> extension,
+      script_parsing::ContentScriptType resources_type,
+      scripting::ResourcesLoadedCallback callback,
+      std::vector<scripting::InjectedFileSource> file_sources,
+      std::optional<std::string> load_error);
+
+  // ExtensionRegistryObserver:
+  void OnExtensionUnloaded(content::BrowserContext* browser_context,
+                           const Extension* extension,
+                           UnloadedExtensionReason reason) override;
+
+  // BrowserContextKeyedAPI:
+  static const char* service_name() { return "ScriptSourceCache"; }
+
+  // Weak reference; the registry outlives this keyed service.
+  raw_ptr<ExtensionRegistry> registry_;
+
+  std::map<ExtensionId, Sources> sources_;
+
+  base::ScopedObservation<ExtensionRegistry, ExtensionRegistryObserver>
+      extension_registry_observation_{this};
+
+  base::WeakPtrFactory<ScriptSourceCache> weak_factory_{this};
+};
+
+template <>
+void BrowserContextKeyedAPIFactory<
+    ScriptSourceCache>::DeclareFactoryDependencies();
+
+}  // namespace extensions
+
+#endif  // ELECTRON_SHELL_BROWSER_EXTENSIONS_API_SCRIPTING_SCRIPT_SOURCE_CACHE_H_
@@ -42,6 +42,7 @@
 #include "extensions/common/utils/content_script_utils.h"
 #include "extensions/common/utils/extension_types_utils.h"
 #include "shell/browser/api/electron_api_web_contents.h"
+#include "shell/browser/extensions/api/scripting/script_source_cache.h"
 #include "third_party/abseil-cpp/absl/strings/str_format.h"
 
 namespace extensions {
@@ -470,13 +471,14 @@ ExtensionFunction::ResponseAction ScriptingExecuteScriptFunction::Run() {
     // JS files don't require localization.
     constexpr bool kRequiresLocalization = false;
     std::string error;
-    if (!CheckAndLoadFiles(
-            std::move(*injection_.files),
-            script_parsing::ContentScriptType::kJs, *extension(),
-            kRequiresLocalization,
-            base::BindOnce(&ScriptingExecuteScriptFunction::DidLoadResources,
-                           this),
-            &error)) {
+    if (!ScriptSourceCache::Get(browser_context())
+             ->LoadFiles(
+                 std::move(*injection_.files),
+                 script_parsing::ContentScriptType::kJs, *extension(),
+                 kRequiresLocalization,
+                 base::BindOnce(
+                     &ScriptingExecuteScriptFunction::DidLoadResources, this),
+                 &error)) {
       return RespondNow(Error(std::move(error)));
     }
     return RespondLater();
@@ -611,12 +613,14 @@ ExtensionFunction::ResponseAction ScriptingInsertCSSFunction::Run() {
     // CSS files require localization.
     constexpr bool kRequiresLocalization = true;
     std::string error;
-    if (!CheckAndLoadFiles(
-            std::move(*injection_.files),
-            script_parsing::ContentScriptType::kCss, *extension(),
-            kRequiresLocalization,
-            base::BindOnce(&ScriptingInsertCSSFunction::DidLoadResources, this),
-            &error)) {
+    if (!ScriptSourceCache::Get(browser_context())
+             ->LoadFiles(
+                 std::move(*injection_.files),
+                 script_parsing::ContentScriptType::kCss, *extension(),
+                 kRequiresLocalization,
+                 base::BindOnce(&ScriptingInsertCSSFunction::DidLoadResources,
+                                this),
+                 &error)) {
       return RespondNow(Error(std::move(error)));
     }
     return RespondLater();
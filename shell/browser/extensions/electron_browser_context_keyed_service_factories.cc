@@ -5,6 +5,7 @@
 #include "shell/browser/extensions/electron_browser_context_keyed_service_factories.h"
 
 #include "extensions/browser/updater/update_service_factory.h"
+#include "shell/browser/extensions/api/scripting/script_source_cache.h"
 #include "shell/browser/extensions/electron_extension_system_factory.h"
 
 namespace extensions::electron {
@@ -15,6 +16,7 @@ void EnsureBrowserContextKeyedServiceFactoriesBuilt() {
   UpdateServiceFactory::GetInstance();
 
   ElectronExtensionSystemFactory::GetInstance();
+  ScriptSourceCache::GetFactoryInstance();
 }
 
 }  // namespace extensions::electron
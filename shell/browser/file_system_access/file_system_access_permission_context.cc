@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "base/base_paths.h"
+#include "base/containers/adapters.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/json/values_util.h"
@@ -82,6 +83,9 @@ struct Converter<
 namespace {
 
 using BlockType = ChromeFileSystemAccessPermissionContext::BlockType;
+using BlockPathRule = ChromeFileSystemAccessPermissionContext::BlockPathRule;
+using BlockPathTrie = electron::PathTrie<BlockPathRule>;
+using BlockPathIndex = base::RefCountedData<BlockPathTrie>;
 using HandleType = content::FileSystemAccessPermissionContext::HandleType;
 using GrantType = electron::FileSystemAccessPermissionContext::GrantType;
 using SensitiveEntryResult =
@@ -152,20 +156,13 @@ bool MaybeIsLocalUNCPath(const base::FilePath& path) {
 }
 #endif  // BUILDFLAG(IS_WIN)
 
-bool ShouldBlockAccessToPath(
-    base::FilePath path,
-    HandleType handle_type,
-    std::vector<ChromeFileSystemAccessPermissionContext::BlockPathRule>
-        extra_rules,
-    ChromeFileSystemAccessPermissionContext::BlockPathRules block_path_rules) {
+bool ShouldBlockAccessToPath(base::FilePath path,
+                             HandleType handle_type,
+                             scoped_refptr<BlockPathIndex> block_path_rules) {
   DCHECK(!path.empty());
   DCHECK(path.IsAbsolute());
 
   path = ChromeFileSystemAccessPermissionContext::NormalizeFilePath(path);
-  for (auto& rule : extra_rules) {
-    rule.path =
-        ChromeFileSystemAccessPermissionContext::NormalizeFilePath(rule.path);
-  }
 
 #if BUILDFLAG(IS_WIN)
   // On Windows, local UNC paths are rejected, as UNC path can be written in a
@@ -175,54 +172,40 @@ bool ShouldBlockAccessToPath(
   }
 #endif
 
-  base::FilePath nearest_ancestor;
-  BlockType nearest_ancestor_block_type = BlockType::kDontBlockChildren;
-  auto should_block_with_rule = [&](const base::FilePath& block_path,
-                                    BlockType block_type) -> bool {
-    if (path == block_path || path.IsParent(block_path)) {
-      VLOG(1) << "Blocking access to " << path << " because it is a parent of "
-              << block_path;
-      return true;
-    }
+  const BlockPathTrie& rules = block_path_rules->data;
+  if (rules.ContainsPathOrDescendant(path)) {
+    VLOG(1) << "Blocking access to " << path
+            << " because it is a blocked path or a parent of one";
+    return true;
+  }
 
-    if (block_path.IsParent(path) &&
-        (nearest_ancestor.empty() || nearest_ancestor.IsParent(block_path))) {
-      nearest_ancestor = block_path;
-      nearest_ancestor_block_type = block_type;
-    }
+  const BlockPathRule* nearest_ancestor = nullptr;
+  rules.VisitAncestors(path, [&nearest_ancestor](const BlockPathRule& rule) {
+    nearest_ancestor = &rule;
     return false;
-  };
-
-  for (const auto* block_rules_ptr :
-       {&extra_rules, &block_path_rules.block_path_rules_}) {
-    for (const auto& block : *block_rules_ptr) {
-      if (should_block_with_rule(block.path, block.type)) {
-        return true;
-      }
-    }
-  }
+  });
 
   // The path we're checking is not in a potentially blocked directory, or the
   // nearest ancestor does not block access to its children. Grant access.
-  if (nearest_ancestor.empty() ||
-      nearest_ancestor_block_type == BlockType::kDontBlockChildren) {
-    VLOG(1) << "Not blocking access to " << path << " because it is inside "
-            << nearest_ancestor << " and it's kDontBlockChildren";
+  if (!nearest_ancestor ||
+      nearest_ancestor->type == BlockType::kDontBlockChildren) {
+    VLOG(1) << "Not blocking access to " << path
+            << " because it is not inside a directory that blocks its children";
     return false;
   }
 
   // The path we're checking is a file, and the nearest ancestor only blocks
   // access to directories. Grant access.
   if (handle_type == HandleType::kFile &&
-      nearest_ancestor_block_type == BlockType::kBlockNestedDirectories) {
+      nearest_ancestor->type == BlockType::kBlockNestedDirectories) {
     VLOG(1) << "Not blocking access to " << path << " because it is inside "
-            << nearest_ancestor << " and it's kBlockNestedDirectories";
+            << nearest_ancestor->path << " and it's kBlockNestedDirectories";
     return false;
   }
 
   // The nearest ancestor blocks access to its children, so block access.
   VLOG(1) << "Blocking access to " << path << " because it is inside "
-          << nearest_ancestor << " and it's kBlockAllChildren";
+          << nearest_ancestor->path << " and it's kBlockAllChildren";
   return true;
 }
 
@@ -380,6 +363,7 @@ class FileSystemAccessPermissionContext::PermissionGrantImpl
 
   static void UpdateGrantPath(
       std::map<base::FilePath, PermissionGrantImpl*>& grants,
+      PathTrie<PermissionGrantImpl*>& grants_index,
       const content::PathInfo& old_path,
       const content::PathInfo& new_path) {
     DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
@@ -401,7 +385,9 @@ class FileSystemAccessPermissionContext::PermissionGrantImpl
 
     // Update the permission grant's key in the map of active permissions.
     grants.erase(entry_it);
-    grants.emplace(new_path.path, grant_impl);
+    grants_index.Erase(old_path.path);
+    if (grants.emplace(new_path.path, grant_impl).second)
+      grants_index.Insert(new_path.path, grant_impl);
   }
 
  protected:
@@ -456,6 +442,10 @@ struct FileSystemAccessPermissionContext::OriginState {
   // PermissionGrantDestroyed().
   std::map<base::FilePath, PermissionGrantImpl*> read_grants;
   std::map<base::FilePath, PermissionGrantImpl*> write_grants;
+  // The same grants indexed by path components, so that the grants of all
+  // of a path's ancestors are found in one walk down the path.
+  PathTrie<PermissionGrantImpl*> read_grants_index;
+  PathTrie<PermissionGrantImpl*> write_grants_index;
 };
 
 FileSystemAccessPermissionContext::FileSystemAccessPermissionContext(
@@ -482,9 +472,17 @@ void FileSystemAccessPermissionContext::ResetBlockPaths() {
 void FileSystemAccessPermissionContext::UpdateBlockPaths(
     std::unique_ptr<ChromeFileSystemAccessPermissionContext::BlockPathRules>
         block_path_rules) {
-  block_path_rules_ = std::move(block_path_rules);
+  // Index the rules by path once, instead of comparing every path checked
+  // with each of them. Where several rules have the same path the first one
+  // applies, so insert them in reverse.
+  BlockPathTrie rules;
+  for (const auto& rule :
+       base::Reversed(block_path_rules->block_path_rules_)) {
+    rules.Insert(rule.path, rule);
+  }
+  block_path_rules_ = base::MakeRefCounted<BlockPathIndex>(std::move(rules));
   is_block_path_rules_init_complete_ = true;
-  block_rules_check_callbacks_.Notify(*block_path_rules_.get());
+  block_rules_check_callbacks_.Notify(block_path_rules_);
 }
 
 scoped_refptr<content::FileSystemAccessPermissionGrant>
@@ -514,6 +512,7 @@ FileSystemAccessPermissionContext::GetReadPermissionGrant(
         weak_factory_.GetWeakPtr(), origin, path_info, handle_type,
         GrantType::kRead, user_action);
     existing_grant = grant.get();
+    origin_state.read_grants_index.Insert(path_info.path, grant.get());
   } else {
     grant = existing_grant;
   }
@@ -572,6 +571,7 @@ FileSystemAccessPermissionContext::GetWritePermissionGrant(
         weak_factory_.GetWeakPtr(), origin, path_info, handle_type,
         GrantType::kWrite, user_action);
     existing_grant = grant.get();
+    origin_state.write_grants_index.Insert(path_info.path, grant.get());
   } else {
     grant = existing_grant;
   }
@@ -643,14 +643,13 @@ void FileSystemAccessPermissionContext::ConfirmSensitiveEntryAccess(
 void FileSystemAccessPermissionContext::CheckShouldBlockAccessToPathAndReply(
     base::FilePath path,
     HandleType handle_type,
-    std::vector<ChromeFileSystemAccessPermissionContext::BlockPathRule>
-        extra_rules,
     base::OnceCallback<void(bool)> callback,
-    ChromeFileSystemAccessPermissionContext::BlockPathRules block_path_rules) {
+    scoped_refptr<BlockPathIndex> block_path_rules) {
+  // Normalizing the path resolves symbolic links, which may block.
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
-      base::BindOnce(&ShouldBlockAccessToPath, path, handle_type, extra_rules,
-                     block_path_rules),
+      base::BindOnce(&ShouldBlockAccessToPath, std::move(path), handle_type,
+                     std::move(block_path_rules)),
       std::move(callback));
 }
 
@@ -669,19 +668,12 @@ void FileSystemAccessPermissionContext::CheckPathAgainstBlocklist(
     return;
   }
 
-  // Unlike the DIR_USER_DATA check, this handles the --user-data-dir override.
-  // We check for the user data dir in two different ways: directly, via the
-  // profile manager, where it exists (it does not in unit tests), and via the
-  // profile's directory, assuming the profile dir is a child of the user data
-  // dir.
-  std::vector<ChromeFileSystemAccessPermissionContext::BlockPathRule>
-      extra_rules;
   if (is_block_path_rules_init_complete_) {
     // The rules initialization is completed, we can just post the task to a
     // anonymous blocking traits.
     CheckShouldBlockAccessToPathAndReply(path_info.path, handle_type,
-                                         extra_rules, std::move(callback),
-                                         *block_path_rules_.get());
+                                         std::move(callback),
+                                         block_path_rules_);
     return;
   }
   // The check must be performed after the rules initialization is done.
@@ -689,7 +681,7 @@ void FileSystemAccessPermissionContext::CheckPathAgainstBlocklist(
       base::BindOnce(&FileSystemAccessPermissionContext::
                          CheckShouldBlockAccessToPathAndReply,
                      weak_factory_.GetWeakPtr(), path_info.path, handle_type,
-                     extra_rules, std::move(callback))));
+                     std::move(callback))));
 }
 
 void FileSystemAccessPermissionContext::PerformAfterWriteChecks(
@@ -907,10 +899,12 @@ void FileSystemAccessPermissionContext::NotifyEntryMoved(
 
   auto it = active_permissions_map_.find(origin);
   if (it != active_permissions_map_.end()) {
-    PermissionGrantImpl::UpdateGrantPath(it->second.write_grants, old_path,
-                                         new_path);
-    PermissionGrantImpl::UpdateGrantPath(it->second.read_grants, old_path,
-                                         new_path);
+    PermissionGrantImpl::UpdateGrantPath(it->second.write_grants,
+                                         it->second.write_grants_index,
+                                         old_path, new_path);
+    PermissionGrantImpl::UpdateGrantPath(it->second.read_grants,
+                                         it->second.read_grants_index,
+                                         old_path, new_path);
   }
 }
 
@@ -1020,22 +1014,16 @@ bool FileSystemAccessPermissionContext::AncestorHasActivePermission(
     return false;
   }
   const auto& relevant_grants = grant_type == GrantType::kWrite
-                                    ? it->second.write_grants
-                                    : it->second.read_grants;
+                                    ? it->second.write_grants_index
+                                    : it->second.read_grants_index;
   if (relevant_grants.empty()) {
     return false;
   }
 
   // Permissions are inherited from the closest ancestor.
-  for (base::FilePath parent = path.DirName(); parent != parent.DirName();
-       parent = parent.DirName()) {
-    auto i = relevant_grants.find(parent);
-    if (i != relevant_grants.end() && i->second &&
-        i->second->GetStatus() == PermissionStatus::GRANTED) {
-      return true;
-    }
-  }
-  return false;
+  return relevant_grants.VisitAncestors(path, [](PermissionGrantImpl* grant) {
+    return grant && grant->GetStatus() == PermissionStatus::GRANTED;
+  });
 }
 
 void FileSystemAccessPermissionContext::PermissionGrantDestroyed(
@@ -1048,6 +1036,9 @@ void FileSystemAccessPermissionContext::PermissionGrantDestroyed(
 
   auto& grants = grant->type() == GrantType::kRead ? it->second.read_grants
                                                    : it->second.write_grants;
+  auto& grants_index = grant->type() == GrantType::kRead
+                           ? it->second.read_grants_index
+                           : it->second.write_grants_index;
   auto grant_it = grants.find(grant->GetPath());
   // Any non-denied permission grants should have still been in our grants
   // list. If this invariant is violated we would have permissions that might
@@ -1063,6 +1054,7 @@ void FileSystemAccessPermissionContext::PermissionGrantDestroyed(
   // destroyed.
   if (grant_it->second == grant) {
     grants.erase(grant_it);
+    grants_index.Erase(grant->GetPath());
   }
 }
 
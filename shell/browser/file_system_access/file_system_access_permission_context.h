@@ -14,12 +14,14 @@
 
 #include "base/callback_list.h"
 #include "base/functional/callback_forward.h"
+#include "base/memory/ref_counted.h"
 #include "base/memory/weak_ptr.h"
 #include "base/time/clock.h"
 #include "base/time/default_clock.h"
 #include "base/values.h"
 #include "chrome/browser/file_system_access/chrome_file_system_access_permission_context.h"  // nogncheck
 #include "components/keyed_service/core/keyed_service.h"
+#include "shell/browser/file_system_access/path_trie.h"
 
 class GURL;
 
@@ -134,15 +136,18 @@ class FileSystemAccessPermissionContext
  private:
   class PermissionGrantImpl;
 
+  // The block rules indexed by path, shared with the checks running on the
+  // thread pool.
+  using BlockPathIndex = base::RefCountedData<
+      PathTrie<ChromeFileSystemAccessPermissionContext::BlockPathRule>>;
+
   void PermissionGrantDestroyed(PermissionGrantImpl* grant);
 
   void CheckShouldBlockAccessToPathAndReply(
       base::FilePath path,
       HandleType handle_type,
-      std::vector<ChromeFileSystemAccessPermissionContext::BlockPathRule>
-          extra_rules,
       base::OnceCallback<void(bool)> callback,
-      ChromeFileSystemAccessPermissionContext::BlockPathRules block_path_rules);
+      scoped_refptr<BlockPathIndex> block_path_rules);
 
   void CheckPathAgainstBlocklist(const content::PathInfo& path,
                                  HandleType handle_type,
@@ -190,12 +195,10 @@ class FileSystemAccessPermissionContext
   std::map<base::FilePath, base::OnceCallback<void(SensitiveEntryResult)>>
       callback_map_;
 
-  std::unique_ptr<ChromeFileSystemAccessPermissionContext::BlockPathRules>
-      block_path_rules_;
+  scoped_refptr<BlockPathIndex> block_path_rules_;
   bool is_block_path_rules_init_complete_ = false;
   std::vector<base::CallbackListSubscription> block_rules_check_subscription_;
-  base::OnceCallbackList<void(
-      ChromeFileSystemAccessPermissionContext::BlockPathRules)>
+  base::OnceCallbackList<void(scoped_refptr<BlockPathIndex>)>
       block_rules_check_callbacks_;
 
   base::WeakPtrFactory<FileSystemAccessPermissionContext> weak_factory_{this};
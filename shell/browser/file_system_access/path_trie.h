@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_FILE_SYSTEM_ACCESS_PATH_TRIE_H_
+#define ELECTRON_SHELL_BROWSER_FILE_SYSTEM_ACCESS_PATH_TRIE_H_
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "build/build_config.h"
+
+#if BUILDFLAG(IS_WIN)
+#include "base/strings/string_util.h"
+#endif
+
+namespace electron {
+
+// A map from paths to values that is stored as a tree of path components, so
+// that the values stored for a path and all of its ancestors are found in a
+// single walk down the path's components, without building each ancestor's
+// path. Paths are compared component by component like
+// base::FilePath::IsParent() compares them.
+template <typename T>
+class PathTrie {
+ public:
+  PathTrie() = default;
+  ~PathTrie() = default;
+
+  PathTrie(PathTrie&&) = default;
+  PathTrie& operator=(PathTrie&&) = default;
+
+  // Stores |value| for |path|, replacing the value it had.
+  void Insert(const base::FilePath& path, T value) {
+    std::vector<Node*> nodes = {&root_};
+    for (auto& component : GetComponents(path)) {
+      std::unique_ptr<Node>& child = nodes.back()->children[component];
+      if (!child)
+        child = std::make_unique<Node>();
+      nodes.push_back(child.get());
+    }
+    if (!nodes.back()->value) {
+      for (Node* node : nodes)
+        ++node->subtree_size;
+    }
+    nodes.back()->value = std::move(value);
+  }
+
+  // Removes the value stored for |path|, if any.
+  void Erase(const base::FilePath& path) {
+    std::vector<std::pair<Node*, base::FilePath::StringType>> nodes = {
+        {&root_, {}}};
+    for (auto& component : GetComponents(path)) {
+      auto it = nodes.back().first->children.find(component);
+      if (it == nodes.back().first->children.end())
+        return;
+      nodes.emplace_back(it->second.get(), std::move(component));
+    }
+    if (!nodes.back().first->value)
+      return;
+    nodes.back().first->value.reset();
+    for (auto& [node, unused] : nodes)
+      --node->subtree_size;
+    // Drop the nodes that no longer lead to any value.
+    for (size_t i = nodes.size() - 1; i > 0 && !nodes[i].first->subtree_size;
+         --i) {
+      nodes[i - 1].first->children.erase(nodes[i].second);
+    }
+  }
+
+  void Clear() { root_ = Node(); }
+
+  bool empty() const { return !root_.subtree_size; }
+
+  // Runs |visitor| with the value stored for each strict ancestor of |path|,
+  // starting from the root, until it returns true. Returns whether it did.
+  template <typename Visitor>
+  bool VisitAncestors(const base::FilePath& path, Visitor visitor) const {
+    const std::vector<base::FilePath::StringType> components =
+        GetComponents(path);
+    const Node* node = &root_;
+    for (size_t i = 0; i + 1 < components.size(); ++i) {
+      auto it = node->children.find(components[i]);
+      if (it == node->children.end())
+        return false;
+      node = it->second.get();
+      if (node->value && visitor(*node->value))
+        return true;
+    }
+    return false;
+  }
+
+  // Returns whether a value is stored for |path| or any of its descendants.
+  bool ContainsPathOrDescendant(const base::FilePath& path) const {
+    const Node* node = &root_;
+    for (const auto& component : GetComponents(path)) {
+      auto it = node->children.find(component);
+      if (it == node->children.end())
+        return false;
+      node = it->second.get();
+    }
+    return node->subtree_size > 0;
+  }
+
+ private:
+  struct Node {
+    std::map<base::FilePath::StringType, std::unique_ptr<Node>> children;
+    std::optional<T> value;
+    // The number of values stored in this node and below it.
+    size_t subtree_size = 0;
+  };
+
+  static std::vector<base::FilePath::StringType> GetComponents(
+      const base::FilePath& path) {
+    std::vector<base::FilePath::StringType> components =
+        path.StripTrailingSeparators().GetComponents();
+#if BUILDFLAG(IS_WIN)
+    // Drive letters are never case sensitive.
+    if (!components.empty() && components[0].size() == 2 &&
+        components[0][1] == L':') {
+      components[0] = base::ToUpperASCII(components[0]);
+    }
+#endif
+    return components;
+  }
+
+  Node root_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_FILE_SYSTEM_ACCESS_PATH_TRIE_H_
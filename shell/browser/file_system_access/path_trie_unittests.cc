@@ -0,0 +1,193 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/file_system_access/path_trie.h"
+
+#include <string>
+#include <vector>
+
+#include "base/containers/adapters.h"
+#include "base/files/file_path.h"
+#include "build/build_config.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace electron {
+
+namespace {
+
+#if BUILDFLAG(IS_WIN)
+constexpr base::FilePath::CharType kRoot[] = FILE_PATH_LITERAL("C:\\");
+#else
+constexpr base::FilePath::CharType kRoot[] = FILE_PATH_LITERAL("/");
+#endif
+
+base::FilePath Path(const base::FilePath::StringType& relative_path) {
+  return base::FilePath(kRoot).Append(relative_path);
+}
+
+// Returns the values stored for the strict ancestors of |path|, root first.
+std::vector<std::string> Ancestors(const PathTrie<std::string>& trie,
+                                   const base::FilePath& path) {
+  std::vector<std::string> values;
+  trie.VisitAncestors(path, [&values](const std::string& value) {
+    values.push_back(value);
+    return false;
+  });
+  return values;
+}
+
+// Mirrors how FileSystemAccessPermissionContext applies its block path rules:
+// a path is blocked if it is a rule's path or one of its parents, or if the
+// nearest rule above it blocks its children.
+struct Rule {
+  std::string name;
+  bool blocks_children;
+};
+
+bool IsBlocked(const PathTrie<Rule>& rules, const base::FilePath& path) {
+  if (rules.ContainsPathOrDescendant(path))
+    return true;
+  const Rule* nearest_ancestor = nullptr;
+  rules.VisitAncestors(path, [&nearest_ancestor](const Rule& rule) {
+    nearest_ancestor = &rule;
+    return false;
+  });
+  return nearest_ancestor && nearest_ancestor->blocks_children;
+}
+
+}  // namespace
+
+TEST(PathTrieTest, InsertAndVisitAncestors) {
+  PathTrie<std::string> trie;
+  EXPECT_TRUE(trie.empty());
+
+  trie.Insert(Path(FILE_PATH_LITERAL("a")), "a");
+  trie.Insert(Path(FILE_PATH_LITERAL("a/b/c")), "c");
+  EXPECT_FALSE(trie.empty());
+
+  EXPECT_EQ(Ancestors(trie, Path(FILE_PATH_LITERAL("a/b/c/d"))),
+            (std::vector<std::string>{"a", "c"}));
+  // Only strict ancestors are visited.
+  EXPECT_EQ(Ancestors(trie, Path(FILE_PATH_LITERAL("a/b/c"))),
+            (std::vector<std::string>{"a"}));
+  EXPECT_TRUE(Ancestors(trie, Path(FILE_PATH_LITERAL("a"))).empty());
+  EXPECT_TRUE(Ancestors(trie, Path(FILE_PATH_LITERAL("ab/c"))).empty());
+
+  // Inserting a path again replaces its value.
+  trie.Insert(Path(FILE_PATH_LITERAL("a")), "a2");
+  EXPECT_EQ(Ancestors(trie, Path(FILE_PATH_LITERAL("a/b"))),
+            (std::vector<std::string>{"a2"}));
+}
+
+TEST(PathTrieTest, VisitAncestorsStopsWhenVisitorReturnsTrue) {
+  PathTrie<std::string> trie;
+  trie.Insert(Path(FILE_PATH_LITERAL("a")), "a");
+  trie.Insert(Path(FILE_PATH_LITERAL("a/b")), "b");
+
+  std::vector<std::string> visited;
+  EXPECT_TRUE(trie.VisitAncestors(Path(FILE_PATH_LITERAL("a/b/c")),
+                                  [&visited](const std::string& value) {
+                                    visited.push_back(value);
+                                    return true;
+                                  }));
+  EXPECT_EQ(visited, std::vector<std::string>{"a"});
+  EXPECT_FALSE(trie.VisitAncestors(Path(FILE_PATH_LITERAL("x/y")),
+                                   [](const std::string&) { return true; }));
+}
+
+TEST(PathTrieTest, ContainsPathOrDescendant) {
+  PathTrie<std::string> trie;
+  trie.Insert(Path(FILE_PATH_LITERAL("a/b/c")), "c");
+
+  EXPECT_TRUE(trie.ContainsPathOrDescendant(Path(FILE_PATH_LITERAL("a/b/c"))));
+  EXPECT_TRUE(trie.ContainsPathOrDescendant(Path(FILE_PATH_LITERAL("a/b"))));
+  EXPECT_TRUE(trie.ContainsPathOrDescendant(base::FilePath(kRoot)));
+  EXPECT_FALSE(
+      trie.ContainsPathOrDescendant(Path(FILE_PATH_LITERAL("a/b/c/d"))));
+  EXPECT_FALSE(trie.ContainsPathOrDescendant(Path(FILE_PATH_LITERAL("a/bc"))));
+  // Trailing separators don't matter.
+  EXPECT_TRUE(trie.ContainsPathOrDescendant(
+      Path(FILE_PATH_LITERAL("a/b")).AsEndingWithSeparator()));
+}
+
+TEST(PathTrieTest, Erase) {
+  PathTrie<std::string> trie;
+  trie.Insert(Path(FILE_PATH_LITERAL("a")), "a");
+  trie.Insert(Path(FILE_PATH_LITERAL("a/b/c")), "c");
+
+  // Erasing a path without a value, or an unknown path, changes nothing.
+  trie.Erase(Path(FILE_PATH_LITERAL("a/b")));
+  trie.Erase(Path(FILE_PATH_LITERAL("x")));
+  EXPECT_EQ(Ancestors(trie, Path(FILE_PATH_LITERAL("a/b/c/d"))),
+            (std::vector<std::string>{"a", "c"}));
+
+  trie.Erase(Path(FILE_PATH_LITERAL("a/b/c")));
+  EXPECT_FALSE(trie.ContainsPathOrDescendant(Path(FILE_PATH_LITERAL("a/b"))));
+  EXPECT_TRUE(trie.ContainsPathOrDescendant(Path(FILE_PATH_LITERAL("a"))));
+  EXPECT_EQ(Ancestors(trie, Path(FILE_PATH_LITERAL("a/b/c/d"))),
+            std::vector<std::string>{"a"});
+
+  trie.Erase(Path(FILE_PATH_LITERAL("a")));
+  EXPECT_TRUE(trie.empty());
+
+  trie.Insert(Path(FILE_PATH_LITERAL("a")), "a");
+  trie.Clear();
+  EXPECT_TRUE(trie.empty());
+}
+
+TEST(PathTrieTest, FirstRuleForAPathWins) {
+  const std::vector<Rule> rule_list = {{"first", true}, {"second", false}};
+  PathTrie<Rule> rules;
+  for (const Rule& rule : base::Reversed(rule_list))
+    rules.Insert(Path(FILE_PATH_LITERAL("a")), rule);
+
+  std::vector<std::string> visited;
+  rules.VisitAncestors(Path(FILE_PATH_LITERAL("a/b")),
+                       [&visited](const Rule& rule) {
+                         visited.push_back(rule.name);
+                         return false;
+                       });
+  EXPECT_EQ(visited, std::vector<std::string>{"first"});
+  EXPECT_TRUE(IsBlocked(rules, Path(FILE_PATH_LITERAL("a/b"))));
+}
+
+TEST(PathTrieTest, NearestAncestorRuleApplies) {
+  PathTrie<Rule> rules;
+  rules.Insert(Path(FILE_PATH_LITERAL("home")), {"home", true});
+  rules.Insert(Path(FILE_PATH_LITERAL("home/user")), {"user", false});
+  rules.Insert(Path(FILE_PATH_LITERAL("home/user/.ssh")), {"ssh", true});
+
+  EXPECT_TRUE(IsBlocked(rules, Path(FILE_PATH_LITERAL("home/other"))));
+  EXPECT_FALSE(IsBlocked(rules, Path(FILE_PATH_LITERAL("home/user/docs"))));
+  EXPECT_TRUE(IsBlocked(rules, Path(FILE_PATH_LITERAL("home/user/.ssh/id"))));
+  EXPECT_FALSE(IsBlocked(rules, Path(FILE_PATH_LITERAL("tmp/file"))));
+}
+
+TEST(PathTrieTest, ParentsOfRulesAreBlocked) {
+  PathTrie<Rule> rules;
+  rules.Insert(Path(FILE_PATH_LITERAL("home/user")), {"user", false});
+
+  EXPECT_TRUE(IsBlocked(rules, Path(FILE_PATH_LITERAL("home/user"))));
+  EXPECT_TRUE(IsBlocked(rules, Path(FILE_PATH_LITERAL("home"))));
+  EXPECT_TRUE(IsBlocked(rules, base::FilePath(kRoot)));
+  EXPECT_FALSE(IsBlocked(rules, Path(FILE_PATH_LITERAL("home/other"))));
+}
+
+#if BUILDFLAG(IS_WIN)
+TEST(PathTrieTest, DriveLettersAreCaseInsensitive) {
+  PathTrie<std::string> trie;
+  trie.Insert(base::FilePath(FILE_PATH_LITERAL("c:\\Windows")), "windows");
+
+  EXPECT_TRUE(trie.ContainsPathOrDescendant(
+      base::FilePath(FILE_PATH_LITERAL("C:\\Windows"))));
+  EXPECT_EQ(Ancestors(trie, base::FilePath(
+                                FILE_PATH_LITERAL("C:\\Windows\\System32"))),
+            std::vector<std::string>{"windows"});
+  // Only the drive letter is folded.
+  EXPECT_FALSE(trie.ContainsPathOrDescendant(
+      base::FilePath(FILE_PATH_LITERAL("C:\\WINDOWS"))));
+}
+#endif
+
+}  // namespace electron
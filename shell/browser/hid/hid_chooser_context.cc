@@ -348,9 +348,23 @@ bool HidChooserContext::HasDevicePermission(
 
   auto* permission_manager = static_cast<ElectronPermissionManager*>(
       browser_context_->GetPermissionControllerDelegate());
+  // Only a device permission handler is given the device's collections and
+  // report descriptors. The permission store just needs the identifiers
+  // persistent permissions are granted by.
+  base::Value device_value;
+  if (permission_manager->HasDevicePermissionHandler()) {
+    device_value = DeviceInfoToValue(device);
+  } else if (CanStorePersistentEntry(device)) {
+    device_value = base::Value(base::Value::Dict()
+                                   .Set(kDeviceVendorIdKey, device.vendor_id)
+                                   .Set(kDeviceProductIdKey, device.product_id)
+                                   .Set(kDeviceSerialNumberKey,
+                                        device.serial_number));
+  } else {
+    return false;
+  }
   return permission_manager->CheckDevicePermission(
-      blink::PermissionType::HID, origin, DeviceInfoToValue(device),
-      browser_context_);
+      blink::PermissionType::HID, origin, device_value, browser_context_);
 }
 
 bool HidChooserContext::IsFidoAllowedForOrigin(const url::Origin& origin) {
@@ -0,0 +1,330 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/ui/views/constraint_layout.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "ui/base/class_property.h"
+#include "ui/gfx/geometry/rect.h"
+#include "ui/views/layout/flex_layout_types.h"
+#include "ui/views/view.h"
+#include "ui/views/view_class_properties.h"
+
+namespace electron {
+
+namespace {
+
+// The flex behavior a view had before its constraints replaced it.
+struct SavedFlexBehavior {
+  std::optional<views::FlexSpecification> flex_behavior;
+};
+
+}  // namespace
+
+}  // namespace electron
+
+DEFINE_UI_CLASS_PROPERTY_TYPE(electron::LayoutConstraints*)
+DEFINE_UI_CLASS_PROPERTY_TYPE(electron::SavedFlexBehavior*)
+
+namespace electron {
+
+namespace {
+
+DEFINE_OWNED_UI_CLASS_PROPERTY_KEY(LayoutConstraints,
+                                   kLayoutConstraintsKey,
+                                   nullptr)
+DEFINE_OWNED_UI_CLASS_PROPERTY_KEY(SavedFlexBehavior,
+                                   kSavedFlexBehaviorKey,
+                                   nullptr)
+
+// Lets FlexLayout size a child anywhere between its constraints' limits,
+// taking as much of the offered space as it is allowed to.
+gfx::Size ConstrainedFlexRule(const LayoutConstraints& constraints,
+                              const views::View* view,
+                              const views::SizeBounds& size_bounds) {
+  const gfx::Size preferred = view->GetPreferredSize(size_bounds);
+  return constraints.Clamp(
+      {size_bounds.width().is_bounded() ? size_bounds.width().value()
+                                        : preferred.width(),
+       size_bounds.height().is_bounded() ? size_bounds.height().value()
+                                         : preferred.height()});
+}
+
+// Sizes |tracks| to share |available| space, less the gaps between them.
+// Flexible tracks that would fall outside their limits are frozen at the
+// limit and the remaining space is shared among the others again. When the
+// space is unbounded flexible tracks take their minimum size.
+std::vector<int> ResolveTracks(const std::vector<GridTrack>& tracks,
+                               const views::SizeBound& available,
+                               int gap) {
+  std::vector<int> sizes(tracks.size());
+  std::vector<bool> frozen(tracks.size());
+  const int max_int = std::numeric_limits<int>::max();
+
+  int free_space = available.is_bounded() ? available.value() : 0;
+  if (!tracks.empty())
+    free_space -= gap * static_cast<int>(tracks.size() - 1);
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    const GridTrack& track = tracks[i];
+    if (track.flex > 0 && available.is_bounded())
+      continue;
+    const int size = track.flex > 0 ? track.minimum_size : track.size;
+    sizes[i] = std::clamp(size, track.minimum_size,
+                          std::max(track.minimum_size,
+                                   track.maximum_size.value_or(max_int)));
+    frozen[i] = true;
+    free_space -= sizes[i];
+  }
+
+  while (true) {
+    double total_flex = 0;
+    for (size_t i = 0; i < tracks.size(); ++i) {
+      if (!frozen[i])
+        total_flex += tracks[i].flex;
+    }
+    if (total_flex <= 0)
+      break;
+
+    bool froze_any = false;
+    for (size_t i = 0; i < tracks.size(); ++i) {
+      if (frozen[i])
+        continue;
+      const GridTrack& track = tracks[i];
+      const double share = std::max(0, free_space) * track.flex / total_flex;
+      std::optional<int> limit;
+      if (share < track.minimum_size)
+        limit = track.minimum_size;
+      else if (track.maximum_size && share > *track.maximum_size)
+        limit = std::max(track.minimum_size, *track.maximum_size);
+      if (limit) {
+        sizes[i] = *limit;
+        frozen[i] = true;
+        free_space -= *limit;
+        froze_any = true;
+      }
+    }
+    if (froze_any)
+      continue;
+
+    // Everything left fits within its limits. Hand out whole pixels and give
+    // the rounding remainder to the last flexible track so the tracks fill the
+    // space exactly.
+    const int shared = std::max(0, free_space);
+    int assigned = 0;
+    size_t last = tracks.size();
+    for (size_t i = 0; i < tracks.size(); ++i) {
+      if (frozen[i])
+        continue;
+      sizes[i] = static_cast<int>(shared * tracks[i].flex / total_flex);
+      assigned += sizes[i];
+      last = i;
+    }
+    if (last < tracks.size())
+      sizes[last] += shared - assigned;
+    break;
+  }
+  return sizes;
+}
+
+// Returns the offset of each track and the position just past the last one.
+std::vector<int> TrackOffsets(const std::vector<int>& sizes,
+                              int start,
+                              int gap) {
+  std::vector<int> offsets;
+  offsets.reserve(sizes.size() + 1);
+  int offset = start;
+  for (int size : sizes) {
+    offsets.push_back(offset);
+    offset += size + gap;
+  }
+  offsets.push_back(sizes.empty() ? start : offset - gap);
+  return offsets;
+}
+
+// Returns |bound| less |inset|, or |bound| if it's unbounded.
+views::SizeBound Inset(const views::SizeBound& bound, int inset) {
+  if (!bound.is_bounded())
+    return bound;
+  return std::max(0, bound.value() - inset);
+}
+
+}  // namespace
+
+gfx::Size LayoutConstraints::Clamp(const gfx::Size& size) const {
+  const int max_int = std::numeric_limits<int>::max();
+  return {std::clamp(size.width(), minimum_width,
+                     std::max(minimum_width, maximum_width.value_or(max_int))),
+          std::clamp(size.height(), minimum_height,
+                     std::max(minimum_height,
+                              maximum_height.value_or(max_int)))};
+}
+
+void SetLayoutConstraints(views::View* view,
+                          std::optional<LayoutConstraints> constraints) {
+  const SavedFlexBehavior* saved = view->GetProperty(kSavedFlexBehaviorKey);
+  if (constraints && (constraints->flex || constraints->flex_order)) {
+    if (!saved) {
+      SavedFlexBehavior previous;
+      if (const auto* flex_behavior =
+              view->GetProperty(views::kFlexBehaviorKey)) {
+        previous.flex_behavior = *flex_behavior;
+      }
+      view->SetProperty(kSavedFlexBehaviorKey, std::move(previous));
+    }
+    view->SetProperty(
+        views::kFlexBehaviorKey,
+        views::FlexSpecification(
+            base::BindRepeating(&ConstrainedFlexRule, *constraints))
+            .WithWeight(constraints->flex.value_or(0))
+            .WithOrder(constraints->flex_order.value_or(1)));
+  } else if (saved) {
+    if (saved->flex_behavior)
+      view->SetProperty(views::kFlexBehaviorKey, *saved->flex_behavior);
+    else
+      view->ClearProperty(views::kFlexBehaviorKey);
+    view->ClearProperty(kSavedFlexBehaviorKey);
+  }
+
+  if (constraints)
+    view->SetProperty(kLayoutConstraintsKey, std::move(*constraints));
+  else
+    view->ClearProperty(kLayoutConstraintsKey);
+  // Invalidating the child invalidates the parent's layout manager too.
+  view->InvalidateLayout();
+}
+
+GridLayout::GridLayout(std::vector<GridTrack> columns,
+                       std::vector<GridTrack> rows,
+                       int column_gap,
+                       int row_gap,
+                       const gfx::Insets& interior_margin)
+    : columns_(std::move(columns)),
+      rows_(std::move(rows)),
+      column_gap_(column_gap),
+      row_gap_(row_gap),
+      interior_margin_(interior_margin) {}
+
+GridLayout::~GridLayout() = default;
+
+views::ProposedLayout GridLayout::CalculateProposedLayout(
+    const views::SizeBounds& size_bounds) const {
+  const gfx::Insets insets = host_view()->GetInsets() + interior_margin_;
+  const std::vector<int> column_offsets =
+      TrackOffsets(ResolveTracks(columns_,
+                                 Inset(size_bounds.width(), insets.width()),
+                                 column_gap_),
+                   insets.left(), column_gap_);
+  const std::vector<int> row_offsets = TrackOffsets(
+      ResolveTracks(rows_, Inset(size_bounds.height(), insets.height()),
+                    row_gap_),
+      insets.top(), row_gap_);
+
+  views::ProposedLayout layout;
+  layout.host_size = {
+      size_bounds.width().is_bounded() ? size_bounds.width().value()
+                                       : column_offsets.back() + insets.right(),
+      size_bounds.height().is_bounded() ? size_bounds.height().value()
+                                        : row_offsets.back() + insets.bottom()};
+
+  for (views::View* child : host_view()->children()) {
+    if (!IsChildIncludedInLayout(child))
+      continue;
+    const LayoutConstraints* constraints =
+        child->GetProperty(kLayoutConstraintsKey);
+    const LayoutConstraints defaults;
+    if (!constraints)
+      constraints = &defaults;
+
+    views::ChildLayout child_layout;
+    child_layout.child_view = child;
+    // Children placed outside the grid aren't shown.
+    const size_t column = std::max(0, constraints->column);
+    const size_t row = std::max(0, constraints->row);
+    child_layout.visible = column < columns_.size() && row < rows_.size();
+    if (child_layout.visible) {
+      const size_t column_end = std::clamp<size_t>(
+          column + std::max(1, constraints->column_span), 1, columns_.size());
+      const size_t row_end = std::clamp<size_t>(
+          row + std::max(1, constraints->row_span), 1, rows_.size());
+      // The end offset of a span excludes the gap after its last track.
+      const int width = column_offsets[column_end] - column_offsets[column] -
+                        (column_end < columns_.size() ? column_gap_ : 0);
+      const int height = row_offsets[row_end] - row_offsets[row] -
+                         (row_end < rows_.size() ? row_gap_ : 0);
+      child_layout.bounds = gfx::Rect(
+          gfx::Point(column_offsets[column], row_offsets[row]),
+          constraints->Clamp({std::max(0, width), std::max(0, height)}));
+      child_layout.available_size =
+          views::SizeBounds(child_layout.bounds.size());
+    }
+    layout.child_layouts.push_back(std::move(child_layout));
+  }
+  return layout;
+}
+
+AnchorLayout::AnchorLayout() = default;
+
+AnchorLayout::~AnchorLayout() = default;
+
+views::ProposedLayout AnchorLayout::CalculateProposedLayout(
+    const views::SizeBounds& size_bounds) const {
+  const gfx::Insets insets = host_view()->GetInsets();
+  const gfx::Size host_size =
+      size_bounds.is_fully_bounded()
+          ? gfx::Size(size_bounds.width().value(), size_bounds.height().value())
+          : host_view()->size();
+  gfx::Rect container(host_size);
+  container.Inset(insets);
+
+  views::ProposedLayout layout;
+  layout.host_size = host_size;
+  for (views::View* child : host_view()->children()) {
+    if (!IsChildIncludedInLayout(child))
+      continue;
+
+    views::ChildLayout child_layout;
+    child_layout.child_view = child;
+    child_layout.visible = true;
+    child_layout.bounds = child->bounds();
+
+    const LayoutConstraints* c = child->GetProperty(kLayoutConstraintsKey);
+    if (c && (c->left || c->top || c->right || c->bottom || c->width ||
+              c->height)) {
+      const bool stretch_x = c->left && c->right;
+      const bool stretch_y = c->top && c->bottom;
+      // The preferred size can be expensive, only ask for it when an axis has
+      // neither a size nor two anchors.
+      gfx::Size preferred;
+      if ((!stretch_x && !c->width) || (!stretch_y && !c->height))
+        preferred =
+            child->GetPreferredSize(views::SizeBounds(container.size()));
+      gfx::Size size = c->Clamp(
+          {stretch_x ? container.width() - *c->left - *c->right
+                     : c->width.value_or(preferred.width()),
+           stretch_y ? container.height() - *c->top - *c->bottom
+                     : c->height.value_or(preferred.height())});
+      size.SetToMax(gfx::Size());
+      gfx::Rect bounds(container.origin(), size);
+      if (c->left)
+        bounds.set_x(container.x() + *c->left);
+      else if (c->right)
+        bounds.set_x(container.right() - *c->right - size.width());
+      if (c->top)
+        bounds.set_y(container.y() + *c->top);
+      else if (c->bottom)
+        bounds.set_y(container.bottom() - *c->bottom - size.height());
+      child_layout.bounds = bounds;
+    }
+
+    child_layout.available_size = views::SizeBounds(child_layout.bounds.size());
+    layout.child_layouts.push_back(std::move(child_layout));
+  }
+  return layout;
+}
+
+}  // namespace electron
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_UI_VIEWS_CONSTRAINT_LAYOUT_H_
+#define ELECTRON_SHELL_BROWSER_UI_VIEWS_CONSTRAINT_LAYOUT_H_
+
+#include <optional>
+#include <vector>
+
+#include "ui/gfx/geometry/insets.h"
+#include "ui/gfx/geometry/size.h"
+#include "ui/views/layout/layout_manager_base.h"
+
+namespace views {
+class View;
+}
+
+namespace electron {
+
+// Per-child layout parameters, stored on the child view. Which fields are used
+// depends on the layout manager of the parent. GridLayout and AnchorLayout
+// always apply the size limits; FlexLayout only applies them when |flex| or
+// |flex_order| is set, since the child otherwise keeps its own flex behavior.
+struct LayoutConstraints {
+  // FlexLayout: share of the free space along the main axis, and the order in
+  // which children are allocated space. The child's own flex behavior is only
+  // replaced when one of them is set.
+  std::optional<int> flex;
+  std::optional<int> flex_order;
+
+  // GridLayout: the cell the child is placed in.
+  int column = 0;
+  int row = 0;
+  int column_span = 1;
+  int row_span = 1;
+
+  // AnchorLayout: distances from the parent's edges. When both opposite edges
+  // are set the child stretches between them, otherwise |width| or |height|
+  // (or the child's preferred size) is used. A child with no anchor on an
+  // axis is placed at the start of that axis.
+  std::optional<int> left;
+  std::optional<int> top;
+  std::optional<int> right;
+  std::optional<int> bottom;
+  std::optional<int> width;
+  std::optional<int> height;
+
+  int minimum_width = 0;
+  int minimum_height = 0;
+  std::optional<int> maximum_width;
+  std::optional<int> maximum_height;
+
+  gfx::Size Clamp(const gfx::Size& size) const;
+};
+
+// Stores |constraints| on |view|, or clears them when empty. When they set a
+// flex weight or order, |view|'s flex behavior is replaced so that a parent
+// FlexLayout honors them and their size limits; the previous behavior is
+// restored once the constraints no longer do.
+void SetLayoutConstraints(views::View* view,
+                          std::optional<LayoutConstraints> constraints);
+
+// A row or column of a GridLayout. Tracks with a zero |flex| have a fixed
+// |size|; the others share the space left over in proportion to |flex|,
+// within their size limits.
+struct GridTrack {
+  int size = 0;
+  double flex = 0;
+  int minimum_size = 0;
+  std::optional<int> maximum_size;
+};
+
+class GridLayout : public views::LayoutManagerBase {
+ public:
+  GridLayout(std::vector<GridTrack> columns,
+             std::vector<GridTrack> rows,
+             int column_gap,
+             int row_gap,
+             const gfx::Insets& interior_margin);
+  ~GridLayout() override;
+
+  // disable copy
+  GridLayout(const GridLayout&) = delete;
+  GridLayout& operator=(const GridLayout&) = delete;
+
+ protected:
+  // views::LayoutManagerBase
+  views::ProposedLayout CalculateProposedLayout(
+      const views::SizeBounds& size_bounds) const override;
+
+ private:
+  const std::vector<GridTrack> columns_;
+  const std::vector<GridTrack> rows_;
+  const int column_gap_;
+  const int row_gap_;
+  const gfx::Insets interior_margin_;
+};
+
+// Positions each child relative to the parent's edges according to its
+// LayoutConstraints. Children without any anchors or sizes keep the bounds
+// they were given with View::SetBoundsRect().
+class AnchorLayout : public views::LayoutManagerBase {
+ public:
+  AnchorLayout();
+  ~AnchorLayout() override;
+
+  // disable copy
+  AnchorLayout(const AnchorLayout&) = delete;
+  AnchorLayout& operator=(const AnchorLayout&) = delete;
+
+ protected:
+  // views::LayoutManagerBase
+  views::ProposedLayout CalculateProposedLayout(
+      const views::SizeBounds& size_bounds) const override;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_UI_VIEWS_CONSTRAINT_LAYOUT_H_
@@ -2,8 +2,10 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <optional>
 #include <vector>
 
+#include "electron/fuses.h"
 #include "shell/common/asar/archive.h"
 #include "shell/common/asar/asar_util.h"
 #include "shell/common/gin_converters/file_path_converter.h"
@@ -28,6 +30,8 @@ class Archive : public node::ObjectWrap {
     NODE_SET_PROTOTYPE_METHOD(tpl, "copyFileOut", &Archive::CopyFileOut);
     NODE_SET_PROTOTYPE_METHOD(tpl, "getFdAndValidateIntegrityLater",
                               &Archive::GetFD);
+    NODE_SET_PROTOTYPE_METHOD(tpl, "getHeaderIntegrity",
+                              &Archive::GetHeaderIntegrity);
 
     return tpl;
   }
@@ -185,6 +189,31 @@ class Archive : public node::ObjectWrap {
         isolate, wrap->archive_ ? wrap->archive_->GetUnsafeFD() : -1));
   }
 
+  // Returns the integrity of the archive header embedded in the app bundle,
+  // or undefined when header integrity is not being validated.
+  static void GetHeaderIntegrity(
+      const v8::FunctionCallbackInfo<v8::Value>& args) {
+    auto* isolate = args.GetIsolate();
+    auto* wrap = node::ObjectWrap::Unwrap<Archive>(args.This());
+
+    // Mirror the conditions under which Archive::Init() validates the header,
+    // HeaderIntegrity() is fatal for archives it can't look up.
+    std::optional<asar::IntegrityPayload> integrity;
+    if (wrap->archive_ &&
+        electron::fuses::IsEmbeddedAsarIntegrityValidationEnabled() &&
+        wrap->archive_->RelativePath().has_value()) {
+      integrity = wrap->archive_->HeaderIntegrity();
+    }
+    if (!integrity.has_value() ||
+        integrity->algorithm == asar::HashAlgorithm::kNone)
+      return;
+
+    gin_helper::Dictionary dict(isolate, v8::Object::New(isolate));
+    dict.Set("algorithm", "SHA256");
+    dict.Set("hash", integrity->hash);
+    args.GetReturnValue().Set(dict.GetHandle());
+  }
+
   std::shared_ptr<asar::Archive> archive_;
 };
 
@@ -6,15 +6,20 @@
 
 #include <map>
 
+#include "base/compiler_specific.h"
 #include "base/containers/to_vector.h"
 #include "base/run_loop.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "shell/browser/browser.h"
 #include "shell/common/gin_converters/image_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/locker.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/node_util.h"
 #include "shell/common/process_util.h"
+#include "shell/common/v8_util.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/base/clipboard/clipboard_format_type.h"
 #include "ui/base/clipboard/file_info.h"
@@ -24,6 +29,55 @@
 
 namespace electron::api {
 
+namespace {
+
+// The async readers use ui::Clipboard's callback-based reads, which complete
+// without blocking on platforms whose clipboard is asynchronous (X11 and
+// Wayland). Results are delivered from a task instead of a nested RunLoop.
+
+void ResolveWithHTML(gin_helper::Promise<std::u16string> promise,
+                     std::u16string markup,
+                     GURL src_url,
+                     uint32_t fragment_start,
+                     uint32_t fragment_end) {
+  if (fragment_start > fragment_end || fragment_end > markup.size())
+    promise.Resolve(markup);
+  else
+    promise.Resolve(
+        markup.substr(fragment_start, fragment_end - fragment_start));
+}
+
+void ResolveWithBuffer(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                       std::string data) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  promise.Resolve(electron::Buffer::Copy(isolate, data).ToLocalChecked());
+}
+
+void DecodePngAndResolve(gin_helper::Promise<gfx::Image> promise,
+                         const std::vector<uint8_t>& png) {
+  // Large screenshots take a while to decode, so that happens off the
+  // calling thread too.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(
+          [](const std::vector<uint8_t>& png) {
+            return gfx::PNGCodec::Decode(png);
+          },
+          png),
+      base::BindOnce(
+          [](gin_helper::Promise<gfx::Image> promise, const SkBitmap& bitmap) {
+            promise.Resolve(gfx::Image::CreateFrom1xBitmap(bitmap));
+          },
+          std::move(promise)));
+}
+
+}  // namespace
+
 ui::ClipboardBuffer Clipboard::GetClipboardBuffer(gin_helper::Arguments* args) {
   std::string type;
   if (args->GetNext(&type) && type == "selection")
@@ -41,6 +95,18 @@ std::vector<std::u16string> Clipboard::AvailableFormats(
   return format_types;
 }
 
+v8::Local<v8::Promise> Clipboard::AvailableFormatsAsync(
+    gin_helper::Arguments* args) {
+  gin_helper::Promise<std::vector<std::u16string>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  ui::Clipboard::GetForCurrentThread()->ReadAvailableTypes(
+      GetClipboardBuffer(args), /* data_dst = */ nullptr,
+      base::BindOnce(
+          &gin_helper::Promise<std::vector<std::u16string>>::ResolvePromise,
+          std::move(promise)));
+  return handle;
+}
+
 bool Clipboard::Has(const std::string& format_string,
                     gin_helper::Arguments* args) {
   ui::Clipboard* clipboard = ui::Clipboard::GetForCurrentThread();
@@ -103,6 +169,20 @@ v8::Local<v8::Value> Clipboard::ReadBuffer(const std::string& format_string,
   return electron::Buffer::Copy(args->isolate(), data).ToLocalChecked();
 }
 
+v8::Local<v8::Promise> Clipboard::ReadBufferAsync(
+    const std::string& format_string,
+    gin_helper::Arguments* args) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  // Unlike read(), this doesn't resolve the custom format names used by web
+  // content, as looking them up reads the clipboard synchronously.
+  ui::Clipboard::GetForCurrentThread()->ReadData(
+      ui::ClipboardFormatType::CustomPlatformType(format_string),
+      /* data_dst = */ nullptr,
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
 void Clipboard::WriteBuffer(const std::string& format,
                             const v8::Local<v8::Value> buffer,
                             gin_helper::Arguments* args) {
@@ -200,6 +280,15 @@ std::u16string Clipboard::ReadHTML(gin_helper::Arguments* args) {
   return data;
 }
 
+v8::Local<v8::Promise> Clipboard::ReadHTMLAsync(gin_helper::Arguments* args) {
+  gin_helper::Promise<std::u16string> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  ui::Clipboard::GetForCurrentThread()->ReadHTML(
+      GetClipboardBuffer(args), /* data_dst = */ nullptr,
+      base::BindOnce(&ResolveWithHTML, std::move(promise)));
+  return handle;
+}
+
 void Clipboard::WriteHTML(const std::u16string& html,
                           gin_helper::Arguments* args) {
   ui::ScopedClipboardWriter writer(GetClipboardBuffer(args));
@@ -255,6 +344,24 @@ gfx::Image Clipboard::ReadImage(gin_helper::Arguments* args) {
   return image.value();
 }
 
+v8::Local<v8::Promise> Clipboard::ReadImageAsync(gin_helper::Arguments* args) {
+  gin_helper::Promise<gfx::Image> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // The ReadPng uses thread pool which requires app ready.
+  if (IsBrowserProcess() && !Browser::Get()->is_ready()) {
+    promise.RejectWithErrorMessage(
+        "clipboard.readImageAsync is available only after app ready in the "
+        "main process");
+    return handle;
+  }
+
+  ui::Clipboard::GetForCurrentThread()->ReadPng(
+      GetClipboardBuffer(args), /* data_dst = */ nullptr,
+      base::BindOnce(&DecodePngAndResolve, std::move(promise)));
+  return handle;
+}
+
 void Clipboard::WriteImage(const gfx::Image& image,
                            gin_helper::Arguments* args) {
   ui::ScopedClipboardWriter writer(GetClipboardBuffer(args));
@@ -267,6 +374,67 @@ void Clipboard::WriteImage(const gfx::Image& image,
   }
 }
 
+void Clipboard::WriteBitmap(v8::Local<v8::Value> buffer,
+                            const gin_helper::Dictionary& options,
+                            gin_helper::Arguments* args) {
+  base::span<uint8_t> pixels;
+  if (buffer->IsArrayBufferView()) {
+    pixels = electron::util::as_byte_span(buffer.As<v8::ArrayBufferView>());
+  } else if (buffer->IsArrayBuffer()) {
+    v8::Local<v8::ArrayBuffer> array_buffer = buffer.As<v8::ArrayBuffer>();
+    pixels = UNSAFE_BUFFERS(
+        base::span{static_cast<uint8_t*>(array_buffer->Data()),
+                   array_buffer->ByteLength()});
+  } else {
+    args->ThrowError("buffer must be an ArrayBuffer or ArrayBufferView");
+    return;
+  }
+
+  int width = 0;
+  int height = 0;
+  if (!options.Get("width", &width) || !options.Get("height", &height) ||
+      width <= 0 || height <= 0) {
+    args->ThrowError("width and height must be positive integers");
+    return;
+  }
+
+  std::string pixel_format = "bgra";
+  options.Get("pixelFormat", &pixel_format);
+  SkColorType color_type;
+  if (pixel_format == "bgra") {
+    color_type = kBGRA_8888_SkColorType;
+  } else if (pixel_format == "rgba") {
+    color_type = kRGBA_8888_SkColorType;
+  } else {
+    args->ThrowError("pixelFormat must be one of 'bgra' or 'rgba'");
+    return;
+  }
+
+  const SkImageInfo info =
+      SkImageInfo::Make(width, height, color_type, kPremul_SkAlphaType);
+  if (pixels.size() != info.computeMinByteSize()) {
+    args->ThrowError("invalid buffer size");
+    return;
+  }
+
+  SkBitmap bitmap;
+  if (color_type == kN32_SkColorType) {
+    // The pixels are already in the order the clipboard expects, so the
+    // writer can use them in place. The platform clipboard converts them to
+    // its own representation when the writer commits, before this returns,
+    // so nothing refers to the buffer afterwards.
+    bitmap.installPixels(info, pixels.data(), info.minRowBytes());
+  } else if (!bitmap.tryAllocN32Pixels(width, height) ||
+             !bitmap.writePixels(
+                 SkPixmap(info, pixels.data(), info.minRowBytes()))) {
+    args->ThrowError("Failed to convert the pixels");
+    return;
+  }
+
+  ui::ScopedClipboardWriter writer(GetClipboardBuffer(args));
+  writer.WriteImage(bitmap);
+}
+
 #if !BUILDFLAG(IS_MAC)
 void Clipboard::WriteFindText(const std::u16string& text) {}
 std::u16string Clipboard::ReadFindText() {
@@ -298,6 +466,8 @@ void Initialize(v8::Local<v8::Object> exports,
   gin_helper::Dictionary dict{isolate, exports};
   dict.SetMethod("availableFormats",
                  &electron::api::Clipboard::AvailableFormats);
+  dict.SetMethod("availableFormatsAsync",
+                 &electron::api::Clipboard::AvailableFormatsAsync);
   dict.SetMethod("has", &electron::api::Clipboard::Has);
   dict.SetMethod("read", &electron::api::Clipboard::Read);
   dict.SetMethod("write", &electron::api::Clipboard::Write);
@@ -306,14 +476,19 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("readRTF", &electron::api::Clipboard::ReadRTF);
   dict.SetMethod("writeRTF", &electron::api::Clipboard::WriteRTF);
   dict.SetMethod("readHTML", &electron::api::Clipboard::ReadHTML);
+  dict.SetMethod("readHTMLAsync", &electron::api::Clipboard::ReadHTMLAsync);
   dict.SetMethod("writeHTML", &electron::api::Clipboard::WriteHTML);
   dict.SetMethod("readBookmark", &electron::api::Clipboard::ReadBookmark);
   dict.SetMethod("writeBookmark", &electron::api::Clipboard::WriteBookmark);
   dict.SetMethod("readImage", &electron::api::Clipboard::ReadImage);
+  dict.SetMethod("readImageAsync", &electron::api::Clipboard::ReadImageAsync);
   dict.SetMethod("writeImage", &electron::api::Clipboard::WriteImage);
+  dict.SetMethod("writeBitmap", &electron::api::Clipboard::WriteBitmap);
   dict.SetMethod("readFindText", &electron::api::Clipboard::ReadFindText);
   dict.SetMethod("writeFindText", &electron::api::Clipboard::WriteFindText);
   dict.SetMethod("readBuffer", &electron::api::Clipboard::ReadBuffer);
+  dict.SetMethod("readBufferAsync",
+                 &electron::api::Clipboard::ReadBufferAsync);
   dict.SetMethod("writeBuffer", &electron::api::Clipboard::WriteBuffer);
   dict.SetMethod("_writeFilesForTesting",
                  &electron::api::Clipboard::WriteFilesForTesting);
@@ -32,6 +32,8 @@ class Clipboard {
   static ui::ClipboardBuffer GetClipboardBuffer(gin_helper::Arguments* args);
   static std::vector<std::u16string> AvailableFormats(
       gin_helper::Arguments* args);
+  static v8::Local<v8::Promise> AvailableFormatsAsync(
+      gin_helper::Arguments* args);
   static bool Has(const std::string& format_string,
                   gin_helper::Arguments* args);
   static void Clear(gin_helper::Arguments* args);
@@ -48,6 +50,7 @@ class Clipboard {
   static void WriteRTF(const std::string& text, gin_helper::Arguments* args);
 
   static std::u16string ReadHTML(gin_helper::Arguments* args);
+  static v8::Local<v8::Promise> ReadHTMLAsync(gin_helper::Arguments* args);
   static void WriteHTML(const std::u16string& html,
                         gin_helper::Arguments* args);
 
@@ -57,13 +60,20 @@ class Clipboard {
                             gin_helper::Arguments* args);
 
   static gfx::Image ReadImage(gin_helper::Arguments* args);
+  static v8::Local<v8::Promise> ReadImageAsync(gin_helper::Arguments* args);
   static void WriteImage(const gfx::Image& image, gin_helper::Arguments* args);
+  static void WriteBitmap(v8::Local<v8::Value> buffer,
+                          const gin_helper::Dictionary& options,
+                          gin_helper::Arguments* args);
 
   static std::u16string ReadFindText();
   static void WriteFindText(const std::u16string& text);
 
   static v8::Local<v8::Value> ReadBuffer(const std::string& format_string,
                                          gin_helper::Arguments* args);
+  static v8::Local<v8::Promise> ReadBufferAsync(
+      const std::string& format_string,
+      gin_helper::Arguments* args);
   static void WriteBuffer(const std::string& format_string,
                           const v8::Local<v8::Value> buffer,
                           gin_helper::Arguments* args);
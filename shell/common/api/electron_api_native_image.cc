@@ -15,7 +15,9 @@
 #include "base/numerics/safe_conversions.h"
 #include "base/strings/pattern.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "gin/arguments.h"
+#include "gin/data_object_builder.h"
 #include "gin/object_template_builder.h"
 #include "gin/per_isolate_data.h"
 #include "net/base/data_url.h"
@@ -29,12 +31,16 @@
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
 #include "shell/common/gin_helper/handle.h"
+#include "shell/common/gin_helper/locker.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/gin_helper/promise.h"
+#include "shell/common/image_cache.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/node_util.h"
 #include "shell/common/process_util.h"
 #include "shell/common/skia_util.h"
 #include "shell/common/thread_restrictions.h"
+#include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
@@ -44,6 +50,7 @@
 #include "ui/gfx/codec/jpeg_codec.h"
 #include "ui/gfx/codec/png_codec.h"
 #include "ui/gfx/geometry/size.h"
+#include "ui/gfx/geometry/size_conversions.h"
 #include "ui/gfx/image/image_skia.h"
 #include "ui/gfx/image/image_skia_operations.h"
 #include "ui/gfx/image/image_util.h"
@@ -126,6 +133,100 @@ base::win::ScopedGDIObject<HICON> ReadICOFromPath(int size,
   return node::Buffer::New(isolate, 0).ToLocalChecked();
 }
 
+skia::ImageOperations::ResizeMethod GetResizeMethod(
+    const base::Value::Dict& options) {
+  const std::string* quality = options.FindString("quality");
+  if (quality && *quality == "good")
+    return skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
+  if (quality && *quality == "better")
+    return skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+  return skia::ImageOperations::ResizeMethod::RESIZE_BEST;
+}
+
+// The async APIs decode, resize and encode on the thread pool. gfx::ImageSkia
+// is bound to the sequence it is used on, so only its representations, whose
+// bitmaps are immutable and ref-counted, are passed between threads.
+constexpr base::TaskTraits kImageTaskTraits = {
+    base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+    base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN};
+
+using ImageReps = std::vector<gfx::ImageSkiaRep>;
+
+// Returns the representations |image| has, or its 1x representation if it
+// only generates them on demand.
+ImageReps GetImageReps(const gfx::Image& image) {
+  const gfx::ImageSkia image_skia = image.AsImageSkia();
+  if (image_skia.isNull())
+    return {};
+  ImageReps reps = image_skia.image_reps();
+  if (reps.empty())
+    reps.push_back(image_skia.GetRepresentation(1.0f));
+  return reps;
+}
+
+gfx::Image ImageFromReps(const ImageReps& reps) {
+  gfx::ImageSkia image_skia;
+  for (const gfx::ImageSkiaRep& rep : reps)
+    image_skia.AddRepresentation(rep);
+  return gfx::Image{image_skia};
+}
+
+struct ResizeTarget {
+  gfx::Size size;
+  skia::ImageOperations::ResizeMethod method;
+};
+
+// Resizes every representation in |reps| to each of |targets|, given in DIPs.
+std::vector<ImageReps> ResizeImageReps(
+    const ImageReps& reps,
+    const std::vector<ResizeTarget>& targets) {
+  std::vector<ImageReps> results;
+  results.reserve(targets.size());
+  for (const ResizeTarget& target : targets) {
+    ImageReps& resized = results.emplace_back();
+    if (target.size.IsEmpty())
+      continue;
+    for (const gfx::ImageSkiaRep& rep : reps) {
+      const gfx::Size pixel_size =
+          gfx::ScaleToCeiledSize(target.size, rep.scale());
+      resized.emplace_back(
+          skia::ImageOperations::Resize(rep.GetBitmap(), target.method,
+                                        pixel_size.width(),
+                                        pixel_size.height()),
+          rep.scale());
+    }
+  }
+  return results;
+}
+
+ImageReps ReadImageRepsFromPath(const base::FilePath& path) {
+  return ImageCache::Get()->GetImageReps(NormalizePath(path));
+}
+
+void ResolveWithImages(gin_helper::Promise<std::vector<gfx::Image>> promise,
+                       std::vector<ImageReps> results) {
+  std::vector<gfx::Image> images;
+  images.reserve(results.size());
+  for (const ImageReps& reps : results)
+    images.push_back(ImageFromReps(reps));
+  promise.Resolve(images);
+}
+
+void ResolveWithImage(gin_helper::Promise<gfx::Image> promise,
+                      std::vector<ImageReps> results) {
+  promise.Resolve(ImageFromReps(results.front()));
+}
+
+void ResolveWithBuffer(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                       std::optional<std::vector<uint8_t>> data) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  promise.Resolve(data ? electron::Buffer::Copy(isolate, *data).ToLocalChecked()
+                       : NewEmptyBuffer(isolate));
+}
+
 }  // namespace
 
 NativeImage::NativeImage(v8::Isolate* isolate, const gfx::Image& image)
@@ -274,6 +375,54 @@ v8::Local<v8::Value> NativeImage::ToJPEG(v8::Isolate* isolate, int quality) {
   return electron::Buffer::Copy(isolate, *encoded_image).ToLocalChecked();
 }
 
+v8::Local<v8::Promise> NativeImage::ToPNGAsync(gin::Arguments* args) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  const float scale_factor = GetScaleFactorFromOptions(args);
+
+  // Images decoded from PNG keep their encoded bytes, which can be returned
+  // without encoding again.
+  if (scale_factor == 1.0f &&
+      image_.HasRepresentation(gfx::Image::kImageRepPNG)) {
+    const scoped_refptr<base::RefCountedMemory> png = image_.As1xPNGBytes();
+    if (png->size() > 0) {
+      promise.Resolve(
+          electron::Buffer::Copy(args->isolate(), *png).ToLocalChecked());
+      return handle;
+    }
+  }
+
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits,
+      base::BindOnce(
+          [](const SkBitmap& bitmap) {
+            return gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false);
+          },
+          bitmap),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
+v8::Local<v8::Promise> NativeImage::ToJPEGAsync(v8::Isolate* isolate,
+                                                int quality) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(1.0f).GetBitmap();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits,
+      base::BindOnce(
+          [](const SkBitmap& bitmap, int quality) {
+            return gfx::JPEGCodec::Encode(bitmap, quality);
+          },
+          bitmap, quality),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
 std::string NativeImage::ToDataURL(gin::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
@@ -338,10 +487,8 @@ float NativeImage::GetAspectRatio(const std::optional<float> scale_factor) {
     return static_cast<float>(size.width()) / static_cast<float>(size.height());
 }
 
-gin_helper::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
-                                                    base::Value::Dict options) {
-  float scale_factor = GetScaleFactorFromOptions(args);
-
+gfx::Size NativeImage::GetResizedSize(const base::Value::Dict& options,
+                                      float scale_factor) {
   gfx::Size size = GetSize(scale_factor);
   std::optional<int> new_width = options.FindInt("width");
   std::optional<int> new_height = options.FindInt("height");
@@ -350,7 +497,7 @@ gin_helper::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
   size.SetSize(width, height);
 
   if (width <= 0 && height <= 0) {
-    return CreateEmpty(args->isolate());
+    return {};
   } else if (new_width && !new_height) {
     // Scale height to preserve original aspect ratio
     size.set_height(width);
@@ -361,18 +508,57 @@ gin_helper::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
     size.set_width(height);
     size = gfx::ScaleToRoundedSize(size, GetAspectRatio(scale_factor), 1.f);
   }
+  return size;
+}
 
-  skia::ImageOperations::ResizeMethod method =
-      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
-  std::string* quality = options.FindString("quality");
-  if (quality && *quality == "good")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
-  else if (quality && *quality == "better")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+gin_helper::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
+                                                    base::Value::Dict options) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  const gfx::Size size = GetResizedSize(options, scale_factor);
+  if (size.IsEmpty())
+    return CreateEmpty(args->isolate());
 
   return Create(args->isolate(),
                 gfx::Image{gfx::ImageSkiaOperations::CreateResizedImage(
-                    image_.AsImageSkia(), method, size)});
+                    image_.AsImageSkia(), GetResizeMethod(options), size)});
+}
+
+v8::Local<v8::Promise> NativeImage::ResizeAsync(gin::Arguments* args,
+                                                base::Value::Dict options) {
+  gin_helper::Promise<gfx::Image> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  const float scale_factor = GetScaleFactorFromOptions(args);
+  std::vector<ResizeTarget> targets = {
+      {GetResizedSize(options, scale_factor), GetResizeMethod(options)}};
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits,
+      base::BindOnce(&ResizeImageReps, GetImageReps(image_),
+                     std::move(targets)),
+      base::BindOnce(&ResolveWithImage, std::move(promise)));
+  return handle;
+}
+
+v8::Local<v8::Promise> NativeImage::ResizeBatchAsync(
+    gin::Arguments* args,
+    const std::vector<base::Value::Dict>& options) {
+  gin_helper::Promise<std::vector<gfx::Image>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  const float scale_factor = GetScaleFactorFromOptions(args);
+  std::vector<ResizeTarget> targets;
+  targets.reserve(options.size());
+  for (const base::Value::Dict& target : options) {
+    targets.push_back(
+        {GetResizedSize(target, scale_factor), GetResizeMethod(target)});
+  }
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits,
+      base::BindOnce(&ResizeImageReps, GetImageReps(image_),
+                     std::move(targets)),
+      base::BindOnce(&ResolveWithImages, std::move(promise)));
+  return handle;
 }
 
 gin_helper::Handle<NativeImage> NativeImage::Crop(v8::Isolate* isolate,
@@ -463,10 +649,8 @@ gin_helper::Handle<NativeImage> NativeImage::CreateFromPath(
                                     new NativeImage(isolate, image_path));
   }
 #endif
-  gfx::ImageSkia image_skia;
-  electron::util::PopulateImageSkiaRepsFromPath(&image_skia, image_path);
-  gfx::Image image(image_skia);
-  gin_helper::Handle<NativeImage> handle = Create(isolate, image);
+  gin_helper::Handle<NativeImage> handle = Create(
+      isolate, ImageFromReps(ImageCache::Get()->GetImageReps(image_path)));
 #if BUILDFLAG(IS_MAC)
   if (IsTemplateFilename(image_path))
     handle->SetTemplateImage(true);
@@ -474,6 +658,44 @@ gin_helper::Handle<NativeImage> NativeImage::CreateFromPath(
   return handle;
 }
 
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromPathAsync(
+    v8::Isolate* isolate,
+    const base::FilePath& path) {
+  gin_helper::Promise<gin_helper::Handle<NativeImage>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+#if BUILDFLAG(IS_WIN)
+  // Icons are loaded through HICONs owned by the NativeImage, so they are
+  // still read on the calling thread.
+  if (path.MatchesExtension(FILE_PATH_LITERAL(".ico"))) {
+    promise.Resolve(CreateFromPath(isolate, path));
+    return handle;
+  }
+#endif
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, kImageTaskTraits,
+      base::BindOnce(&ReadImageRepsFromPath, path),
+      base::BindOnce(
+          [](gin_helper::Promise<gin_helper::Handle<NativeImage>> promise,
+             const base::FilePath& path, ImageReps reps) {
+            v8::Isolate* isolate = promise.isolate();
+            gin_helper::Locker locker(isolate);
+            v8::HandleScope handle_scope(isolate);
+            v8::Context::Scope context_scope(promise.GetContext());
+            gin_helper::Handle<NativeImage> image =
+                Create(isolate, ImageFromReps(reps));
+#if BUILDFLAG(IS_MAC)
+            if (IsTemplateFilename(path))
+              image->SetTemplateImage(true);
+#endif
+            promise.Resolve(image);
+          },
+          std::move(promise), path));
+  return handle;
+}
+
 // static
 gin_helper::Handle<NativeImage> NativeImage::CreateFromBitmap(
     gin_helper::ErrorThrower thrower,
@@ -586,7 +808,9 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
   return gin::ObjectTemplateBuilder(isolate, GetTypeName(),
                                     constructor->InstanceTemplate())
       .SetMethod("toPNG", &NativeImage::ToPNG)
+      .SetMethod("toPNGAsync", &NativeImage::ToPNGAsync)
       .SetMethod("toJPEG", &NativeImage::ToJPEG)
+      .SetMethod("toJPEGAsync", &NativeImage::ToJPEGAsync)
       .SetMethod("toBitmap", &NativeImage::ToBitmap)
       .SetMethod("getBitmap", &NativeImage::GetBitmap)
       .SetMethod("getScaleFactors", &NativeImage::GetScaleFactors)
@@ -599,6 +823,8 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
       .SetProperty("isMacTemplateImage", &NativeImage::IsTemplateImage,
                    &NativeImage::SetTemplateImage)
       .SetMethod("resize", &NativeImage::Resize)
+      .SetMethod("resizeAsync", &NativeImage::ResizeAsync)
+      .SetMethod("resizeBatchAsync", &NativeImage::ResizeBatchAsync)
       .SetMethod("crop", &NativeImage::Crop)
       .SetMethod("getAspectRatio", &NativeImage::GetAspectRatio)
       .SetMethod("addRepresentation", &NativeImage::AddRepresentation);
@@ -618,6 +844,27 @@ namespace {
 
 using electron::api::NativeImage;
 
+v8::Local<v8::Value> GetCacheStats(v8::Isolate* isolate) {
+  const electron::ImageCache::Stats stats =
+      electron::ImageCache::Get()->GetStats();
+  return gin::DataObjectBuilder(isolate)
+      .Set("hits", static_cast<double>(stats.hits))
+      .Set("misses", static_cast<double>(stats.misses))
+      .Set("evictions", static_cast<double>(stats.evictions))
+      .Set("entries", static_cast<double>(stats.entries))
+      .Set("size", static_cast<double>(stats.bytes))
+      .Set("limit", static_cast<double>(stats.limit))
+      .Build();
+}
+
+void SetCacheLimit(gin_helper::ErrorThrower thrower, double limit) {
+  if (!(limit >= 0)) {
+    thrower.ThrowTypeError("limit must be a non-negative number");
+    return;
+  }
+  electron::ImageCache::Get()->SetLimit(static_cast<size_t>(limit));
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -629,11 +876,15 @@ void Initialize(v8::Local<v8::Object> exports,
 
   native_image.SetMethod("createEmpty", &NativeImage::CreateEmpty);
   native_image.SetMethod("createFromPath", &NativeImage::CreateFromPath);
+  native_image.SetMethod("createFromPathAsync",
+                         &NativeImage::CreateFromPathAsync);
   native_image.SetMethod("createFromBitmap", &NativeImage::CreateFromBitmap);
   native_image.SetMethod("createFromBuffer", &NativeImage::CreateFromBuffer);
   native_image.SetMethod("createFromDataURL", &NativeImage::CreateFromDataURL);
   native_image.SetMethod("createFromNamedImage",
                          &NativeImage::CreateFromNamedImage);
+  native_image.SetMethod("getCacheStats", &GetCacheStats);
+  native_image.SetMethod("setCacheLimit", &SetCacheLimit);
 #if !BUILDFLAG(IS_LINUX)
   native_image.SetMethod("createThumbnailFromPath",
                          &NativeImage::CreateThumbnailFromPath);
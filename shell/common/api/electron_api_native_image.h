@@ -69,6 +69,9 @@ class NativeImage final : public gin_helper::DeprecatedWrappable<NativeImage> {
   static gin_helper::Handle<NativeImage> CreateFromPath(
       v8::Isolate* isolate,
       const base::FilePath& path);
+  static v8::Local<v8::Promise> CreateFromPathAsync(
+      v8::Isolate* isolate,
+      const base::FilePath& path);
   static gin_helper::Handle<NativeImage> CreateFromBitmap(
       gin_helper::ErrorThrower thrower,
       v8::Local<v8::Value> buffer,
@@ -111,13 +114,24 @@ class NativeImage final : public gin_helper::DeprecatedWrappable<NativeImage> {
 
  private:
   v8::Local<v8::Value> ToPNG(gin::Arguments* args);
+  v8::Local<v8::Promise> ToPNGAsync(gin::Arguments* args);
   v8::Local<v8::Value> ToJPEG(v8::Isolate* isolate, int quality);
+  v8::Local<v8::Promise> ToJPEGAsync(v8::Isolate* isolate, int quality);
   v8::Local<v8::Value> ToBitmap(gin::Arguments* args);
   std::vector<float> GetScaleFactors();
   v8::Local<v8::Value> GetBitmap(gin::Arguments* args);
   v8::Local<v8::Value> GetNativeHandle(gin_helper::ErrorThrower thrower);
   gin_helper::Handle<NativeImage> Resize(gin::Arguments* args,
                                          base::Value::Dict options);
+  v8::Local<v8::Promise> ResizeAsync(gin::Arguments* args,
+                                     base::Value::Dict options);
+  v8::Local<v8::Promise> ResizeBatchAsync(
+      gin::Arguments* args,
+      const std::vector<base::Value::Dict>& options);
+  // Returns the size in DIPs that resize |options| describe, or an empty size
+  // if the result would be empty.
+  gfx::Size GetResizedSize(const base::Value::Dict& options,
+                           float scale_factor);
   gin_helper::Handle<NativeImage> Crop(v8::Isolate* isolate,
                                        const gfx::Rect& rect);
   std::string ToDataURL(gin::Arguments* args);
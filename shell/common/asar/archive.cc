@@ -267,6 +267,10 @@ bool Archive::Init() {
 }
 
 #if !BUILDFLAG(IS_MAC) && !BUILDFLAG(IS_WIN)
+std::optional<IntegrityPayload> GetEmbeddedIntegrity(std::string_view key) {
+  return std::nullopt;
+}
+
 std::optional<IntegrityPayload> Archive::HeaderIntegrity() const {
   return std::nullopt;
 }
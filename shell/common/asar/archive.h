@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <uv.h>
@@ -37,6 +38,11 @@ struct IntegrityPayload {
   std::vector<std::string> blocks;
 };
 
+// Returns the integrity recorded for |key| in the integrity config embedded
+// in the app (the ElectronAsarIntegrity Info.plist dictionary on macOS, the
+// ElectronAsar resource on Windows), or std::nullopt if there is none.
+std::optional<IntegrityPayload> GetEmbeddedIntegrity(std::string_view key);
+
 // This class represents an asar package, and provides methods to read
 // information from it. It is thread-safe after |Init| has been called.
 class Archive {
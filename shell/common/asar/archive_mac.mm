@@ -10,6 +10,7 @@
 
 #include <iomanip>
 #include <string>
+#include <string_view>
 
 #include "base/apple/bundle_locations.h"
 #include "base/apple/foundation_util.h"
@@ -31,11 +32,7 @@ std::optional<base::FilePath> Archive::RelativePath() const {
   return relative_path;
 }
 
-std::optional<IntegrityPayload> Archive::HeaderIntegrity() const {
-  std::optional<base::FilePath> relative_path = RelativePath();
-  // Callers should have already asserted this
-  CHECK(relative_path.has_value());
-
+std::optional<IntegrityPayload> GetEmbeddedIntegrity(std::string_view key) {
   NSDictionary* integrity = [[NSBundle mainBundle]
       objectForInfoDictionaryKey:@"ElectronAsarIntegrity"];
 
@@ -43,10 +40,8 @@ std::optional<IntegrityPayload> Archive::HeaderIntegrity() const {
   if (!integrity)
     return std::nullopt;
 
-  NSString* ns_relative_path =
-      base::apple::FilePathToNSString(relative_path.value());
-
-  NSDictionary* integrity_payload = [integrity objectForKey:ns_relative_path];
+  NSDictionary* integrity_payload =
+      [integrity objectForKey:base::SysUTF8ToNSString(key)];
 
   if (!integrity_payload)
     return std::nullopt;
@@ -63,4 +58,12 @@ std::optional<IntegrityPayload> Archive::HeaderIntegrity() const {
   return std::nullopt;
 }
 
+std::optional<IntegrityPayload> Archive::HeaderIntegrity() const {
+  std::optional<base::FilePath> relative_path = RelativePath();
+  // Callers should have already asserted this
+  CHECK(relative_path.has_value());
+
+  return GetEmbeddedIntegrity(relative_path->value());
+}
+
 }  // namespace asar
@@ -129,14 +129,22 @@ const auto& GetIntegrityConfigCache() {
 
 }  // namespace
 
+std::optional<IntegrityPayload> GetEmbeddedIntegrity(std::string_view key) {
+  if (const auto* payload =
+          base::FindOrNull(GetIntegrityConfigCache(), base::ToLowerASCII(key)))
+    return *payload;
+
+  return std::nullopt;
+}
+
 std::optional<IntegrityPayload> Archive::HeaderIntegrity() const {
   const std::optional<base::FilePath> relative_path = RelativePath();
   CHECK(relative_path);
 
-  const auto key = base::ToLowerASCII(base::WideToUTF8(relative_path->value()));
+  const auto key = base::WideToUTF8(relative_path->value());
 
-  if (const auto* payload = base::FindOrNull(GetIntegrityConfigCache(), key))
-    return *payload;
+  if (auto payload = GetEmbeddedIntegrity(key))
+    return payload;
 
   LOG(FATAL) << "Failed to find file integrity info for " << key;
 }
@@ -0,0 +1,277 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/async_log_sink.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "base/auto_reset.h"
+#include "base/containers/span.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/synchronization/condition_variable.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "base/threading/platform_thread.h"
+#include "base/time/time.h"
+#include "shell/common/thread_restrictions.h"
+#include "third_party/abseil-cpp/absl/base/attributes.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
+
+namespace electron::log_sink {
+
+namespace {
+
+// How long the flusher waits before writing out a partially filled buffer.
+constexpr base::TimeDelta kFlushInterval = base::Milliseconds(100);
+
+// Pending messages are flushed early once the buffer reaches this size.
+constexpr size_t kFlushThreshold = 64 * 1024;
+
+// Messages are dropped rather than buffered without bound if the flusher
+// can't keep up.
+constexpr size_t kMaxPendingBytes = 4 * 1024 * 1024;
+
+// Each category may log this many messages per window; the rest are counted
+// and reported once the category logs again in a later window.
+constexpr size_t kRateLimitMessages = 100;
+constexpr base::TimeDelta kRateLimitWindow = base::Seconds(1);
+constexpr size_t kMaxTrackedCategories = 1024;
+
+// Set on threads that are inside the sink, so that anything logged while
+// writing goes straight to Chromium's destinations instead of recursing.
+ABSL_CONST_INIT thread_local bool g_in_sink = false;
+
+// Set by Write() so that structured messages are rate limited by their own
+// category rather than by the source location of Write().
+ABSL_CONST_INIT thread_local std::string_view g_category_override;
+
+class Sink : public base::PlatformThread::Delegate {
+ public:
+  static Sink* Get() {
+    static base::NoDestructor<Sink> sink;
+    return sink.get();
+  }
+
+  // disable copy
+  Sink(const Sink&) = delete;
+  Sink& operator=(const Sink&) = delete;
+
+  bool Install(const base::FilePath& log_path, const Options& options) {
+    Flush();
+    bool installed = false;
+    {
+      base::AutoLock write_lock(write_lock_);
+      base::AutoReset<bool> in_sink(&g_in_sink, true);
+      ScopedAllowBlockingForElectron allow_blocking;
+      file_ = base::File(log_path,
+                         base::File::FLAG_OPEN_ALWAYS | base::File::FLAG_APPEND);
+      log_path_ = log_path;
+      options_ = options;
+      installed = file_.IsValid();
+    }
+
+    {
+      base::AutoLock lock(lock_);
+      installed_ = installed;
+    }
+    if (installed && !flusher_started_) {
+      flusher_started_ = base::PlatformThread::CreateNonJoinable(0, this);
+      std::atexit([] { Sink::Get()->Flush(); });
+    }
+    return installed;
+  }
+
+  void Uninstall() {
+    {
+      base::AutoLock lock(lock_);
+      installed_ = false;
+    }
+    Flush();
+    base::AutoLock write_lock(write_lock_);
+    base::AutoReset<bool> in_sink(&g_in_sink, true);
+    ScopedAllowBlockingForElectron allow_blocking;
+    file_.Close();
+  }
+
+  // Returns false if the sink isn't installed, in which case the message
+  // should be handled by Chromium's logging destinations.
+  bool Enqueue(std::string_view category, std::string_view text) {
+    base::AutoLock lock(lock_);
+    if (!installed_)
+      return false;
+
+    const base::TimeTicks now = base::TimeTicks::Now();
+    auto it = categories_.find(category);
+    if (it == categories_.end()) {
+      if (categories_.size() >= kMaxTrackedCategories)
+        categories_.clear();
+      it = categories_.try_emplace(std::string(category)).first;
+    }
+    CategoryState& state = it->second;
+    if (now - state.window_start >= kRateLimitWindow) {
+      if (state.suppressed > 0) {
+        Append(base::StrCat({"[", base::NumberToString(state.suppressed),
+                             " messages from ", category, " suppressed]\n"}));
+      }
+      state = {now, 0, 0};
+    }
+    if (++state.count > kRateLimitMessages) {
+      ++state.suppressed;
+      return true;
+    }
+
+    Append(text);
+    if (pending_.size() >= kFlushThreshold)
+      wake_.Signal();
+    return true;
+  }
+
+  void Flush() {
+    base::AutoLock write_lock(write_lock_);
+    base::AutoReset<bool> in_sink(&g_in_sink, true);
+    {
+      base::AutoLock lock(lock_);
+      writing_.swap(pending_);
+      if (dropped_ > 0) {
+        writing_.append(base::StrCat({"[", base::NumberToString(dropped_),
+                                      " log messages dropped]\n"}));
+        dropped_ = 0;
+      }
+    }
+    if (writing_.empty())
+      return;
+
+    ScopedAllowBlockingForElectron allow_blocking;
+    if (file_.IsValid())
+      file_.WriteAtCurrentPosAndCheck(base::as_byte_span(writing_));
+    if (options_.also_log_to_stderr) {
+      fwrite(writing_.data(), writing_.size(), 1, stderr);
+      fflush(stderr);
+    }
+    writing_.clear();
+
+    if (options_.max_file_size > 0 && file_.IsValid() &&
+        file_.GetLength() > options_.max_file_size)
+      Rotate();
+  }
+
+ private:
+  friend class base::NoDestructor<Sink>;
+
+  struct CategoryState {
+    base::TimeTicks window_start;
+    size_t count = 0;
+    size_t suppressed = 0;
+  };
+
+  Sink() = default;
+  ~Sink() override = default;
+
+  // base::PlatformThread::Delegate
+  void ThreadMain() override {
+    base::PlatformThread::SetName("ElectronLogSink");
+    g_in_sink = true;
+    while (true) {
+      {
+        base::AutoLock lock(lock_);
+        if (pending_.size() < kFlushThreshold)
+          wake_.TimedWait(kFlushInterval);
+      }
+      Flush();
+    }
+  }
+
+  void Append(std::string_view text) EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    if (pending_.size() + text.size() > kMaxPendingBytes) {
+      ++dropped_;
+      return;
+    }
+    pending_.append(text);
+  }
+
+  // Copies the current log to "<file>.1" and truncates it in place, so that
+  // handles held by Chromium's logging and by child processes stay valid.
+  void Rotate() EXCLUSIVE_LOCKS_REQUIRED(write_lock_) {
+    const base::FilePath rotated =
+        log_path_.AddExtension(FILE_PATH_LITERAL("1"));
+    if (!base::CopyFile(log_path_, rotated))
+      return;
+    base::File(log_path_, base::File::FLAG_OPEN | base::File::FLAG_WRITE)
+        .SetLength(0);
+  }
+
+  base::Lock lock_;
+  base::ConditionVariable wake_{&lock_};
+  bool installed_ GUARDED_BY(lock_) = false;
+  std::string pending_ GUARDED_BY(lock_);
+  size_t dropped_ GUARDED_BY(lock_) = 0;
+  absl::flat_hash_map<std::string, CategoryState> categories_
+      GUARDED_BY(lock_);
+
+  base::Lock write_lock_;
+  base::File file_ GUARDED_BY(write_lock_);
+  base::FilePath log_path_ GUARDED_BY(write_lock_);
+  Options options_ GUARDED_BY(write_lock_);
+  std::string writing_ GUARDED_BY(write_lock_);
+
+  // Only touched from the thread that initializes logging.
+  bool flusher_started_ = false;
+};
+
+bool HandleLogMessage(int severity,
+                      const char* file,
+                      int line,
+                      size_t message_start,
+                      const std::string& str) {
+  if (g_in_sink)
+    return false;
+
+  // Fatal messages are about to crash the process, so write out everything
+  // that led up to them and let Chromium log this one synchronously.
+  if (severity == logging::LOGGING_FATAL) {
+    Sink::Get()->Flush();
+    return false;
+  }
+
+  if (!g_category_override.empty())
+    return Sink::Get()->Enqueue(g_category_override, str);
+  return Sink::Get()->Enqueue(
+      base::StrCat({file, ":", base::NumberToString(line)}), str);
+}
+
+}  // namespace
+
+void Install(const base::FilePath& log_path, const Options& options) {
+  if (Sink::Get()->Install(log_path, options))
+    logging::SetLogMessageHandler(&HandleLogMessage);
+  else
+    Uninstall();
+}
+
+void Uninstall() {
+  if (logging::GetLogMessageHandler() != &HandleLogMessage)
+    return;
+  logging::SetLogMessageHandler(nullptr);
+  Sink::Get()->Uninstall();
+}
+
+void Write(int severity, std::string_view category, std::string_view message) {
+  if (!logging::ShouldCreateLogMessage(severity))
+    return;
+
+  base::AutoReset<std::string_view> scoped_category(&g_category_override,
+                                                    category);
+  logging::LogMessage log_message(__FILE__, __LINE__, severity);
+  log_message.stream() << '[' << category << "] " << message;
+}
+
+}  // namespace electron::log_sink
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_ASYNC_LOG_SINK_H_
+#define ELECTRON_SHELL_COMMON_ASYNC_LOG_SINK_H_
+
+#include <cstdint>
+#include <string_view>
+
+namespace base {
+class FilePath;
+}
+
+namespace electron {
+
+// The browser process's log file sink. When installed, messages destined for
+// the log file are appended to an in-memory buffer and written out by a
+// background thread instead of synchronously on the thread that logged them.
+// Messages are rate limited per category (the source location for LOG()
+// statements), and the file is rotated once it grows past a size limit.
+namespace log_sink {
+
+struct Options {
+  // Maximum size of the log file before it is rotated to "<file>.1". Zero
+  // disables rotation.
+  int64_t max_file_size = 0;
+  // Whether flushed messages should also be written to stderr.
+  bool also_log_to_stderr = false;
+};
+
+// Starts routing the current process's file logging through the sink. Must be
+// called after logging::InitLogging() has set up |log_path|. Calling it again
+// flushes pending messages and switches to the new file.
+void Install(const base::FilePath& log_path, const Options& options);
+
+// Stops routing messages through the sink after flushing pending messages.
+void Uninstall();
+
+// Logs |message| with |severity|, rate limited under |category| instead of
+// the caller's source location. Goes to the regular logging destinations when
+// the sink isn't installed.
+void Write(int severity, std::string_view category, std::string_view message);
+
+}  // namespace log_sink
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_ASYNC_LOG_SINK_H_
@@ -4,15 +4,37 @@
 
 #include "shell/common/heap_snapshot.h"
 
+#include <algorithm>
+#include <string_view>
+#include <utility>
+
 #include "base/containers/span.h"
 #include "base/files/file.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/ref_counted.h"
 #include "base/numerics/safe_conversions.h"
+#include "base/synchronization/lock.h"
+#include "base/task/thread_pool.h"
+#include "base/thread_annotations.h"
+#include "base/threading/sequence_bound.h"
+#include "gin/converter.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
+#include "third_party/zlib/zlib.h"
 #include "v8/include/v8-profiler.h"
 #include "v8/include/v8.h"
 
 namespace {
 
+constexpr int kChunkSize = 65536;
+
+// How many bytes of serialized chunks can be waiting to be written before the
+// snapshot is abandoned. Serializing runs on the isolate's thread, which must
+// not wait for the writer, so this bounds the memory a slow disk or
+// compressor can make pile up instead.
+constexpr size_t kMaxPendingBytes = 256 * 1024 * 1024;
+
 class HeapSnapshotOutputStream : public v8::OutputStream {
  public:
   explicit HeapSnapshotOutputStream(base::File* file) : file_(file) {
@@ -22,7 +44,7 @@ class HeapSnapshotOutputStream : public v8::OutputStream {
   [[nodiscard]] bool IsComplete() const { return is_complete_; }
 
   // v8::OutputStream
-  int GetChunkSize() override { return 65536; }
+  int GetChunkSize() override { return kChunkSize; }
   void EndOfStream() override { is_complete_ = true; }
 
   v8::OutputStream::WriteResult WriteAsciiChunk(char* data, int size) override {
@@ -39,6 +61,166 @@ class HeapSnapshotOutputStream : public v8::OutputStream {
   bool is_complete_ = false;
 };
 
+// Counts the bytes that have been handed to the writer but not written yet.
+class PendingBytes : public base::RefCountedThreadSafe<PendingBytes> {
+ public:
+  PendingBytes() = default;
+
+  // disable copy
+  PendingBytes(const PendingBytes&) = delete;
+  PendingBytes& operator=(const PendingBytes&) = delete;
+
+  // Returns false, without waiting, if |size| more bytes would exceed
+  // kMaxPendingBytes.
+  bool TryAdd(size_t size) {
+    base::AutoLock auto_lock(lock_);
+    if (pending_ + size > kMaxPendingBytes)
+      return false;
+    pending_ += size;
+    return true;
+  }
+
+  void Remove(size_t size) {
+    base::AutoLock auto_lock(lock_);
+    pending_ -= size;
+  }
+
+ private:
+  friend class base::RefCountedThreadSafe<PendingBytes>;
+  ~PendingBytes() = default;
+
+  base::Lock lock_;
+  size_t pending_ GUARDED_BY(lock_) = 0;
+};
+
+// Writes serialized snapshot chunks to a file, optionally gzip compressing
+// them. Lives on a background sequence so that neither compression nor file
+// I/O happen on the thread that owns the isolate.
+class HeapSnapshotFileWriter {
+ public:
+  HeapSnapshotFileWriter(base::File file,
+                         electron::HeapSnapshotCompression compression,
+                         scoped_refptr<PendingBytes> pending_bytes)
+      : pending_bytes_(std::move(pending_bytes)),
+        file_(std::move(file)),
+        compress_(compression == electron::HeapSnapshotCompression::kGzip) {
+    if (compress_) {
+      // 16 + MAX_WBITS selects the gzip container rather than raw zlib.
+      failed_ = deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                             16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK;
+      output_.resize(kChunkSize);
+    }
+  }
+
+  ~HeapSnapshotFileWriter() {
+    if (compress_)
+      deflateEnd(&stream_);
+  }
+
+  // disable copy
+  HeapSnapshotFileWriter(const HeapSnapshotFileWriter&) = delete;
+  HeapSnapshotFileWriter& operator=(const HeapSnapshotFileWriter&) = delete;
+
+  void Write(std::string chunk) {
+    if (!failed_) {
+      failed_ = !(compress_ ? Deflate(base::as_byte_span(chunk), Z_NO_FLUSH)
+                            : file_.WriteAtCurrentPosAndCheck(
+                                  base::as_byte_span(chunk)));
+    }
+    pending_bytes_->Remove(chunk.size());
+  }
+
+  bool Finish(bool serialized) {
+    if (!failed_ && compress_)
+      failed_ = !Deflate({}, Z_FINISH);
+    file_.Close();
+    return serialized && !failed_;
+  }
+
+ private:
+  bool Deflate(base::span<const uint8_t> input, int flush) {
+    stream_.next_in = const_cast<Bytef*>(input.data());
+    stream_.avail_in = base::checked_cast<uInt>(input.size());
+    do {
+      stream_.next_out = output_.data();
+      stream_.avail_out = base::checked_cast<uInt>(output_.size());
+      if (deflate(&stream_, flush) == Z_STREAM_ERROR)
+        return false;
+      const size_t produced = output_.size() - stream_.avail_out;
+      if (!file_.WriteAtCurrentPosAndCheck(
+              base::span(output_).first(produced)))
+        return false;
+    } while (stream_.avail_out == 0);
+    return true;
+  }
+
+  scoped_refptr<PendingBytes> pending_bytes_;
+  base::File file_;
+  const bool compress_;
+  bool failed_ = false;
+  z_stream stream_ = {};
+  std::vector<uint8_t> output_;
+};
+
+class BackgroundHeapSnapshotOutputStream : public v8::OutputStream {
+ public:
+  BackgroundHeapSnapshotOutputStream(
+      base::SequenceBound<HeapSnapshotFileWriter>* writer,
+      scoped_refptr<PendingBytes> pending_bytes)
+      : writer_(writer), pending_bytes_(std::move(pending_bytes)) {}
+
+  [[nodiscard]] bool IsComplete() const { return is_complete_; }
+
+  // v8::OutputStream
+  int GetChunkSize() override { return kChunkSize; }
+  void EndOfStream() override { is_complete_ = true; }
+
+  v8::OutputStream::WriteResult WriteAsciiChunk(char* data, int size) override {
+    if (!pending_bytes_->TryAdd(base::saturated_cast<size_t>(size)))
+      return kAbort;
+    // SAFETY: see HeapSnapshotOutputStream::WriteAsciiChunk().
+    writer_->AsyncCall(&HeapSnapshotFileWriter::Write)
+        .WithArgs(std::string(UNSAFE_BUFFERS(
+            std::string_view{data, base::saturated_cast<size_t>(size)})));
+    return kContinue;
+  }
+
+ private:
+  raw_ptr<base::SequenceBound<HeapSnapshotFileWriter>> writer_;
+  scoped_refptr<PendingBytes> pending_bytes_;
+  bool is_complete_ = false;
+};
+
+// Groups nodes the same way as the summary view of the DevTools memory panel.
+std::string GetSummaryName(v8::Isolate* isolate,
+                           const v8::HeapGraphNode* node) {
+  switch (node->GetType()) {
+    case v8::HeapGraphNode::kObject:
+    case v8::HeapGraphNode::kNative:
+      return gin::V8ToString(isolate, node->GetName());
+    case v8::HeapGraphNode::kArray:
+      return "(array)";
+    case v8::HeapGraphNode::kString:
+    case v8::HeapGraphNode::kConsString:
+    case v8::HeapGraphNode::kSlicedString:
+      return "(string)";
+    case v8::HeapGraphNode::kCode:
+      return "(compiled code)";
+    case v8::HeapGraphNode::kClosure:
+      return "(closure)";
+    case v8::HeapGraphNode::kRegExp:
+      return "(regexp)";
+    case v8::HeapGraphNode::kHeapNumber:
+      return "(number)";
+    case v8::HeapGraphNode::kSymbol:
+      return "(symbol)";
+    case v8::HeapGraphNode::kBigInt:
+      return "(bigint)";
+    default:
+      return "(system)";
+  }
+}
+
 }  // namespace
 
 namespace electron {
@@ -62,4 +244,74 @@ bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file) {
   return stream.IsComplete();
 }
 
+void TakeHeapSnapshotInBackground(v8::Isolate* isolate,
+                                  base::File file,
+                                  HeapSnapshotCompression compression,
+                                  base::OnceCallback<void(bool)> callback) {
+  DCHECK(isolate);
+
+  if (!file.IsValid()) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  auto* snapshot = isolate->GetHeapProfiler()->TakeHeapSnapshot();
+  if (!snapshot) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  auto pending_bytes = base::MakeRefCounted<PendingBytes>();
+  base::SequenceBound<HeapSnapshotFileWriter> writer(
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN}),
+      std::move(file), compression, pending_bytes);
+
+  BackgroundHeapSnapshotOutputStream stream(&writer, std::move(pending_bytes));
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+
+  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+
+  // Queued after every chunk, so the reply only runs once they're written.
+  writer.AsyncCall(&HeapSnapshotFileWriter::Finish)
+      .WithArgs(stream.IsComplete())
+      .Then(std::move(callback));
+}
+
+std::vector<HeapSnapshotSummaryEntry> TakeHeapSnapshotSummary(
+    v8::Isolate* isolate) {
+  DCHECK(isolate);
+
+  auto* snapshot = isolate->GetHeapProfiler()->TakeHeapSnapshot();
+  if (!snapshot)
+    return {};
+
+  absl::flat_hash_map<std::string, HeapSnapshotSummaryEntry> entries;
+  {
+    v8::HandleScope handle_scope(isolate);
+    for (int i = 0; i < snapshot->GetNodesCount(); ++i) {
+      const v8::HeapGraphNode* node = snapshot->GetNode(i);
+      if (node->GetType() == v8::HeapGraphNode::kSynthetic)
+        continue;
+      std::string name = GetSummaryName(isolate, node);
+      auto& entry = entries[name];
+      if (entry.name.empty())
+        entry.name = std::move(name);
+      entry.count++;
+      entry.self_size += node->GetShallowSize();
+    }
+  }
+
+  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+
+  std::vector<HeapSnapshotSummaryEntry> result;
+  result.reserve(entries.size());
+  for (auto& [name, entry] : entries)
+    result.push_back(std::move(entry));
+  std::ranges::sort(result, std::ranges::greater{},
+                    &HeapSnapshotSummaryEntry::self_size);
+  return result;
+}
+
 }  // namespace electron
@@ -5,6 +5,12 @@
 #ifndef ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
 #define ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/functional/callback_forward.h"
+
 namespace base {
 class File;
 }
@@ -15,8 +21,34 @@ class Isolate;
 
 namespace electron {
 
+enum class HeapSnapshotCompression { kNone, kGzip };
+
+struct HeapSnapshotSummaryEntry {
+  std::string name;
+  uint64_t count = 0;
+  uint64_t self_size = 0;
+};
+
 bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file);
 
+// Takes a heap snapshot on the calling thread and streams the serialized
+// chunks to a background sequence, which compresses them if requested and
+// writes them to |file|. Serializing never waits for the writer; the snapshot
+// fails instead if more than 256 MiB of chunks are waiting to be written.
+// |callback| runs on the calling sequence once the whole snapshot has been
+// written.
+void TakeHeapSnapshotInBackground(v8::Isolate* isolate,
+                                  base::File file,
+                                  HeapSnapshotCompression compression,
+                                  base::OnceCallback<void(bool)> callback);
+
+// Returns the object count and total shallow size of each constructor in the
+// heap, largest first. This still takes a full snapshot on the calling thread,
+// but skips serializing it, which dominates the cost of TakeHeapSnapshot() on
+// large heaps.
+std::vector<HeapSnapshotSummaryEntry> TakeHeapSnapshotSummary(
+    v8::Isolate* isolate);
+
 }  // namespace electron
 
 #endif  // ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
@@ -0,0 +1,170 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/image_cache.h"
+
+#include <iterator>
+#include <utility>
+
+#include "base/files/file.h"
+#include "base/files/file_util.h"
+#include "base/no_destructor.h"
+#include "shell/common/asar/asar_util.h"
+#include "shell/common/skia_util.h"
+#include "shell/common/thread_restrictions.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "ui/gfx/image/image_skia.h"
+
+namespace electron {
+
+namespace {
+
+// Enough for a few hundred typical tray and menu icons with their @2x
+// variants.
+constexpr size_t kDefaultLimit = 32 * 1024 * 1024;
+
+ImageCache::FileVersion GetFileVersion(const base::FilePath& path) {
+  ImageCache::FileVersion version;
+  base::File::Info info;
+  if (base::GetFileInfo(path, &info) && !info.is_directory) {
+    version.exists = true;
+    version.last_modified = info.last_modified;
+    version.file_size = info.size;
+  }
+  return version;
+}
+
+// Returns the modification times and sizes of |path| and its @Nx variants, or
+// false if it can't be cached. Files inside an asar archive are revalidated
+// against the archive itself, which is replaced as a whole when any of them
+// changes.
+bool GetFileVersions(const base::FilePath& path,
+                     std::vector<ImageCache::FileVersion>* versions) {
+  ScopedAllowBlockingForElectron allow_blocking;
+  base::FilePath asar_path, relative_path;
+  if (asar::GetAsarArchivePath(path, &asar_path, &relative_path)) {
+    ImageCache::FileVersion version = GetFileVersion(asar_path);
+    if (!version.exists)
+      return false;
+    versions->push_back(version);
+    return true;
+  }
+
+  for (const base::FilePath& rep_path : util::GetImageSkiaRepPaths(path)) {
+    ImageCache::FileVersion version = GetFileVersion(rep_path);
+    if (!version.exists && rep_path == path)
+      return false;
+    versions->push_back(version);
+  }
+  return true;
+}
+
+std::vector<gfx::ImageSkiaRep> DecodeImageReps(const base::FilePath& path) {
+  gfx::ImageSkia image_skia;
+  util::PopulateImageSkiaRepsFromPath(&image_skia, path);
+  return image_skia.image_reps();
+}
+
+}  // namespace
+
+ImageCache::Entry::Entry() = default;
+ImageCache::Entry::Entry(Entry&&) = default;
+ImageCache::Entry& ImageCache::Entry::operator=(Entry&&) = default;
+ImageCache::Entry::~Entry() = default;
+
+// static
+ImageCache* ImageCache::Get() {
+  static base::NoDestructor<ImageCache> cache;
+  return cache.get();
+}
+
+ImageCache::ImageCache()
+    : entries_(base::LRUCache<base::FilePath, Entry>::NO_AUTO_EVICT),
+      limit_(kDefaultLimit) {}
+
+ImageCache::~ImageCache() = default;
+
+std::vector<gfx::ImageSkiaRep> ImageCache::GetImageReps(
+    const base::FilePath& path) {
+  Entry entry;
+  if (!GetFileVersions(path, &entry.versions))
+    return DecodeImageReps(path);
+
+  {
+    base::AutoLock lock(lock_);
+    auto it = entries_.Get(path);
+    if (it != entries_.end()) {
+      if (it->second.versions == entry.versions) {
+        ++hits_;
+        return it->second.reps;
+      }
+      // The file or one of its variants changed since it was cached.
+      Erase(it);
+    }
+    ++misses_;
+    if (limit_ == 0)
+      return DecodeImageReps(path);
+  }
+
+  // Decode without holding the lock. If another thread decoded the same file
+  // in the meantime, the last one to finish replaces the other's entry; the
+  // images already handed out keep their bitmaps either way.
+  entry.reps = DecodeImageReps(path);
+  for (gfx::ImageSkiaRep& rep : entry.reps) {
+    SkBitmap bitmap = rep.GetBitmap();
+    bitmap.setImmutable();
+    entry.bytes += bitmap.computeByteSize();
+  }
+  std::vector<gfx::ImageSkiaRep> reps = entry.reps;
+  if (!reps.empty()) {
+    base::AutoLock lock(lock_);
+    Insert(path, std::move(entry));
+  }
+  return reps;
+}
+
+void ImageCache::SetLimit(size_t bytes) {
+  base::AutoLock lock(lock_);
+  limit_ = bytes;
+  EvictToLimit();
+}
+
+ImageCache::Stats ImageCache::GetStats() {
+  base::AutoLock lock(lock_);
+  return {.hits = hits_,
+          .misses = misses_,
+          .evictions = evictions_,
+          .entries = entries_.size(),
+          .bytes = bytes_,
+          .limit = limit_};
+}
+
+void ImageCache::Insert(const base::FilePath& path, Entry entry) {
+  // Images larger than the whole cache would only evict everything else.
+  if (entry.bytes > limit_)
+    return;
+
+  auto existing = entries_.Peek(path);
+  if (existing != entries_.end())
+    Erase(existing);
+
+  bytes_ += entry.bytes;
+  entries_.Put(path, std::move(entry));
+  EvictToLimit();
+}
+
+void ImageCache::Erase(base::LRUCache<base::FilePath, Entry>::iterator it) {
+  bytes_ -= it->second.bytes;
+  entries_.Erase(it);
+}
+
+void ImageCache::EvictToLimit() {
+  while (bytes_ > limit_ && !entries_.empty()) {
+    auto oldest = std::prev(entries_.end());
+    Erase(oldest);
+    ++evictions_;
+  }
+}
+
+}  // namespace electron
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_IMAGE_CACHE_H_
+#define ELECTRON_SHELL_COMMON_IMAGE_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "base/time/time.h"
+#include "ui/gfx/image/image_skia_rep.h"
+
+namespace base {
+template <typename T>
+class NoDestructor;
+}
+
+namespace electron {
+
+// A process-wide cache of images decoded from files, so that images loaded
+// from the same path share their bitmaps instead of each decoding the file
+// again. Entries are keyed by the normalized path and revalidated against the
+// modification times and sizes of the file and its @Nx scale variants, or of
+// the asar archive they are in. The least recently used entries are evicted
+// once the decoded bitmaps exceed the cache's limit.
+//
+// The cache holds gfx::ImageSkiaReps rather than gfx::ImageSkia, which is
+// bound to the sequence it's used on; the reps' bitmaps are immutable and can
+// be shared between threads. All methods are thread-safe.
+class ImageCache {
+ public:
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+    size_t limit = 0;
+  };
+
+  // The state of one of the files an entry was decoded from. Variants that
+  // don't exist are recorded too, so that adding one invalidates the entry.
+  struct FileVersion {
+    bool exists = false;
+    base::Time last_modified;
+    int64_t file_size = 0;
+
+    friend bool operator==(const FileVersion&, const FileVersion&) = default;
+  };
+
+  static ImageCache* Get();
+
+  // disable copy
+  ImageCache(const ImageCache&) = delete;
+  ImageCache& operator=(const ImageCache&) = delete;
+
+  // Returns the representations of the image at |path| and its @Nx scale
+  // variants, decoding them if they aren't cached. May block.
+  std::vector<gfx::ImageSkiaRep> GetImageReps(const base::FilePath& path);
+
+  // Sets the maximum size of the cached bitmaps in bytes, evicting entries as
+  // needed. A limit of zero disables the cache.
+  void SetLimit(size_t bytes);
+
+  Stats GetStats();
+
+ private:
+  friend class base::NoDestructor<ImageCache>;
+
+  struct Entry {
+    Entry();
+    Entry(Entry&&);
+    Entry& operator=(Entry&&);
+    ~Entry();
+
+    std::vector<FileVersion> versions;
+    std::vector<gfx::ImageSkiaRep> reps;
+    size_t bytes = 0;
+  };
+
+  ImageCache();
+  ~ImageCache();
+
+  void Insert(const base::FilePath& path, Entry entry)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void Erase(base::LRUCache<base::FilePath, Entry>::iterator it)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void EvictToLimit() EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  base::Lock lock_;
+  base::LRUCache<base::FilePath, Entry> entries_ GUARDED_BY(lock_);
+  size_t bytes_ GUARDED_BY(lock_) = 0;
+  size_t limit_ GUARDED_BY(lock_);
+  uint64_t hits_ GUARDED_BY(lock_) = 0;
+  uint64_t misses_ GUARDED_BY(lock_) = 0;
+  uint64_t evictions_ GUARDED_BY(lock_) = 0;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_IMAGE_CACHE_H_
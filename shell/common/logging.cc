@@ -16,6 +16,8 @@
 #include "base/strings/string_number_conversions.h"
 #include "chrome/common/chrome_paths.h"
 #include "content/public/common/content_switches.h"
+#include "shell/common/async_log_sink.h"
+#include "shell/common/options_switches.h"
 
 #if BUILDFLAG(IS_WIN)
 #include <windows.h>
@@ -183,6 +185,11 @@ void InitElectronLogging(const base::CommandLine& command_line,
   // problems with sandbox filters, see https://crbug.com/859676
   log_path = log_path.NormalizePathSeparators();
 
+  // Hand pending messages back to Chromium's logging before it reopens (and
+  // possibly deletes) the log file.
+  if (process_type.empty())
+    electron::log_sink::Uninstall();
+
   LoggingSettings settings;
   settings.logging_dest = logging_dest;
   settings.log_file_path = log_path.value().c_str();
@@ -206,6 +213,18 @@ void InitElectronLogging(const base::CommandLine& command_line,
   }
 
   SetLogItems(true /* pid */, false, true /* timestamp */, false);
+
+  // The browser process writes its log file from a background thread, so
+  // that bursts of logging don't block the UI thread on file I/O.
+  if (success && process_type.empty() && (logging_dest & LOG_TO_FILE) != 0 &&
+      !filename_is_handle) {
+    electron::log_sink::Options options;
+    options.also_log_to_stderr = (logging_dest & LOG_TO_STDERR) != 0;
+    base::StringToInt64(
+        command_line.GetSwitchValueASCII(electron::switches::kLogFileMaxSize),
+        &options.max_file_size);
+    electron::log_sink::Install(log_path, options);
+  }
 }
 
 }  // namespace logging
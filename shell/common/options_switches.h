@@ -306,6 +306,9 @@ inline constexpr base::cstring_view kDisableNTLMv2 = "disable-ntlm-v2";
 inline constexpr base::cstring_view kServiceWorkerPreload =
     "service-worker-preload";
 
+// Size in bytes after which the browser process's log file is rotated.
+inline constexpr base::cstring_view kLogFileMaxSize = "log-file-max-size";
+
 }  // namespace switches
 
 }  // namespace electron
@@ -147,6 +147,17 @@ bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
         image, path.InsertBeforeExtensionASCII(pair.name), pair.scale);
   return succeed;
 }
+
+std::vector<base::FilePath> GetImageSkiaRepPaths(const base::FilePath& path) {
+  std::vector<base::FilePath> paths = {path};
+  std::string filename(path.BaseName().RemoveExtension().AsUTF8Unsafe());
+  if (base::MatchPattern(filename, "*@*x"))
+    return paths;
+  for (const ScaleFactorPair& pair : kScaleFactorPairs)
+    paths.push_back(path.InsertBeforeExtensionASCII(pair.name));
+  return paths;
+}
+
 #if BUILDFLAG(IS_WIN)
 bool ReadImageSkiaFromICO(gfx::ImageSkia* image, HICON icon) {
   // Convert the icon from the Windows specific HICON to gfx::ImageSkia.
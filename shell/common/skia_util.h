@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_COMMON_SKIA_UTIL_H_
 
 #include <cstdint>
+#include <vector>
 
 #include "base/containers/span.h"
 
@@ -22,6 +23,10 @@ namespace electron::util {
 bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
                                    const base::FilePath& path);
 
+// Returns the files PopulateImageSkiaRepsFromPath() tries to read for |path|,
+// whether they exist or not.
+std::vector<base::FilePath> GetImageSkiaRepPaths(const base::FilePath& path);
+
 bool AddImageSkiaRepFromBuffer(gfx::ImageSkia* image,
                                base::span<const uint8_t> data,
                                int width,
@@ -8,12 +8,18 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/contains.h"
 #include "base/memory/raw_ptr.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "gin/converter.h"
+#include "mojo/public/cpp/base/big_buffer.h"
 #include "shell/common/api/electron_api_native_image.h"
 #include "skia/public/mojom/bitmap.mojom.h"
 #include "third_party/blink/public/common/messaging/cloneable_message.h"
+#include "third_party/blink/public/common/messaging/transferable_message.h"
 #include "third_party/blink/public/common/messaging/web_message_port.h"
+#include "third_party/blink/public/mojom/array_buffer/array_buffer_contents.mojom.h"
 #include "ui/gfx/image/image_skia.h"
 #include "v8/include/v8.h"
 
@@ -61,6 +67,46 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
     return true;
   }
 
+  bool Serialize(v8::Local<v8::Value> value,
+                 base::span<const v8::Local<v8::ArrayBuffer>> array_buffers,
+                 blink::TransferableMessage* out) {
+    for (size_t i = 0; i < array_buffers.size(); ++i) {
+      const v8::Local<v8::ArrayBuffer>& array_buffer = array_buffers[i];
+      const char* problem = nullptr;
+      if (array_buffer->WasDetached())
+        problem = " is already detached.";
+      else if (!array_buffer->IsDetachable())
+        problem = " is not detachable.";
+      else if (base::Contains(array_buffers.first(i), array_buffer))
+        problem = " is a duplicate.";
+      if (problem) {
+        isolate_->ThrowException(v8::Exception::Error(gin::StringToV8(
+            isolate_, base::StrCat({"ArrayBuffer at index ",
+                                    base::NumberToString(i), problem}))));
+        return false;
+      }
+      serializer_.TransferArrayBuffer(i, array_buffer);
+    }
+
+    if (!Serialize(value, out))
+      return false;
+
+    // Only detach the buffers once the whole value is serialized, so that
+    // they stay usable when it can't be.
+    for (const v8::Local<v8::ArrayBuffer>& array_buffer : array_buffers) {
+      auto contents = blink::mojom::SerializedArrayBufferContents::New();
+      contents->contents =
+          mojo_base::BigBuffer(util::as_byte_span(array_buffer));
+      if (array_buffer->GetBackingStore()->IsResizableByUserJavaScript()) {
+        contents->is_resizable_by_user_javascript = true;
+        contents->max_byte_length = array_buffer->MaxByteLength();
+      }
+      out->array_buffer_contents_array.push_back(std::move(contents));
+      array_buffer->Detach(v8::Local<v8::Value>()).Check();
+    }
+    return true;
+  }
+
   // v8::ValueSerializer::Delegate
   void* ReallocateBufferMemory(void* old_buffer,
                                size_t size,
@@ -125,6 +171,11 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
         deserializer_(isolate, data.data(), data.size(), this) {}
   V8Deserializer(v8::Isolate* isolate, const blink::CloneableMessage& message)
       : V8Deserializer(isolate, message.encoded_message) {}
+  V8Deserializer(v8::Isolate* isolate,
+                 const blink::TransferableMessage& message)
+      : V8Deserializer(isolate, message.encoded_message) {
+    array_buffer_contents_ = &message.array_buffer_contents_array;
+  }
 
   v8::Local<v8::Value> Deserialize() {
     v8::EscapableHandleScope scope(isolate_);
@@ -138,6 +189,8 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
     if (!deserializer_.ReadHeader(context).To(&read_header))
       return v8::Null(isolate_);
     DCHECK(read_header);
+    if (array_buffer_contents_ && !TransferArrayBuffers())
+      return v8::Null(isolate_);
     v8::Local<v8::Value> value;
     if (!deserializer_.ReadValue(context).ToLocal(&value))
       return v8::Null(isolate_);
@@ -195,6 +248,35 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
     return true;
   }
 
+  bool TransferArrayBuffers() {
+    for (size_t i = 0; i < array_buffer_contents_->size(); ++i) {
+      const auto& contents = (*array_buffer_contents_)[i];
+      const size_t byte_length = contents->contents.size();
+      // The contents come from another process, so reject the same lengths
+      // as blink's SerializedArrayBufferContents traits rather than letting
+      // NewResizableBackingStore abort.
+      if (byte_length > v8::ArrayBuffer::kMaxByteLength)
+        return false;
+      v8::Local<v8::ArrayBuffer> array_buffer;
+      if (contents->is_resizable_by_user_javascript) {
+        if (contents->max_byte_length < byte_length ||
+            contents->max_byte_length > v8::ArrayBuffer::kMaxByteLength)
+          return false;
+        array_buffer = v8::ArrayBuffer::New(
+            isolate_, v8::ArrayBuffer::NewResizableBackingStore(
+                          byte_length, contents->max_byte_length));
+      } else {
+        if (contents->max_byte_length != 0)
+          return false;
+        array_buffer = v8::ArrayBuffer::New(isolate_, byte_length);
+      }
+      util::as_byte_span(array_buffer)
+          .copy_from(base::span<const uint8_t>(contents->contents));
+      deserializer_.TransferArrayBuffer(i, array_buffer);
+    }
+    return true;
+  }
+
   api::NativeImage* ReadNativeImage(v8::Isolate* isolate) {
     gfx::ImageSkia image_skia;
     uint32_t num_reps = 0;
@@ -222,6 +304,8 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
 
   raw_ptr<v8::Isolate> isolate_;
   v8::ValueDeserializer deserializer_;
+  raw_ptr<const std::vector<blink::mojom::SerializedArrayBufferContentsPtr>>
+      array_buffer_contents_ = nullptr;
 };
 
 bool SerializeV8Value(v8::Isolate* isolate,
@@ -240,6 +324,19 @@ v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
   return V8Deserializer(isolate, data).Deserialize();
 }
 
+bool SerializeV8Value(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> value,
+    base::span<const v8::Local<v8::ArrayBuffer>> array_buffers,
+    blink::TransferableMessage* out) {
+  return V8Serializer(isolate).Serialize(value, array_buffers, out);
+}
+
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const blink::TransferableMessage& in) {
+  return V8Deserializer(isolate, in).Deserialize();
+}
+
 namespace util {
 
 /**
@@ -258,5 +355,11 @@ base::span<uint8_t> as_byte_span(v8::Local<v8::ArrayBufferView> val) {
   return UNSAFE_BUFFERS(base::span{data, size});
 }
 
+base::span<uint8_t> as_byte_span(v8::Local<v8::ArrayBuffer> val) {
+  uint8_t* data = static_cast<uint8_t*>(val->Data());
+  const size_t size = val->ByteLength();
+  return UNSAFE_BUFFERS(base::span{data, size});
+}
+
 }  // namespace util
 }  // namespace electron
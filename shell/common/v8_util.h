@@ -9,6 +9,7 @@
 #include "ui/gfx/image/image_skia_rep.h"
 
 namespace v8 {
+class ArrayBuffer;
 class ArrayBufferView;
 class Isolate;
 template <class T>
@@ -18,7 +19,8 @@ class Value;
 
 namespace blink {
 struct CloneableMessage;
-}
+struct TransferableMessage;
+}  // namespace blink
 
 namespace electron {
 
@@ -30,10 +32,22 @@ v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         base::span<const uint8_t> data);
 
+// Transfer |array_buffers| rather than cloning them: their contents are copied
+// once into the message, in shared memory when they're large, and they are
+// detached once |value| is serialized.
+bool SerializeV8Value(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> value,
+    base::span<const v8::Local<v8::ArrayBuffer>> array_buffers,
+    blink::TransferableMessage* out);
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const blink::TransferableMessage& in);
+
 namespace util {
 
 [[nodiscard]] base::span<uint8_t> as_byte_span(
     v8::Local<v8::ArrayBufferView> abv);
+[[nodiscard]] base::span<uint8_t> as_byte_span(v8::Local<v8::ArrayBuffer> ab);
 
 }  // namespace util
 }  // namespace electron
@@ -28,6 +28,9 @@ namespace electron::api {
 
 namespace {
 
+// Enough for the vocabulary of a long document.
+constexpr size_t kWordCacheSize = 20000;
+
 bool HasWordCharacters(const std::u16string& text, size_t index) {
   base_icu::UChar32 code;
   while (index < text.size() &&
@@ -51,20 +54,30 @@ struct Word {
 class SpellCheckClient::SpellcheckRequest {
  public:
   SpellcheckRequest(
+      int id,
       const std::u16string& text,
       std::unique_ptr<blink::WebTextCheckingCompletion> completion)
-      : text_(text), completion_(std::move(completion)) {}
+      : id_(id), text_(text), completion_(std::move(completion)) {}
   SpellcheckRequest(const SpellcheckRequest&) = delete;
   SpellcheckRequest& operator=(const SpellcheckRequest&) = delete;
   ~SpellcheckRequest() = default;
 
+  [[nodiscard]] int id() const { return id_; }
   [[nodiscard]] const std::u16string& text() const { return text_; }
   blink::WebTextCheckingCompletion* completion() { return completion_.get(); }
   std::vector<Word>& wordlist() { return word_list_; }
+  std::set<std::u16string>& unchecked_words() { return unchecked_words_; }
+  absl::flat_hash_set<std::u16string>& misspelled_words() {
+    return misspelled_words_;
+  }
 
  private:
+  int id_;
   std::u16string text_;          // Text to be checked in this task.
   std::vector<Word> word_list_;  // List of Words found in text
+  // Words sent to the provider because their spelling wasn't cached.
+  std::set<std::u16string> unchecked_words_;
+  absl::flat_hash_set<std::u16string> misspelled_words_;
   // The interface to send the misspelled ranges to Blink.
   std::unique_ptr<blink::WebTextCheckingCompletion> completion_;
 };
@@ -72,7 +85,8 @@ class SpellCheckClient::SpellcheckRequest {
 SpellCheckClient::SpellCheckClient(const std::string& language,
                                    v8::Isolate* isolate,
                                    v8::Local<v8::Object> provider)
-    : isolate_(isolate),
+    : word_cache_(kWordCacheSize),
+      isolate_(isolate),
       context_(isolate, isolate->GetCurrentContext()),
       provider_(isolate, provider) {
   DCHECK(!context_.IsEmpty());
@@ -104,8 +118,8 @@ void SpellCheckClient::RequestCheckingOfText(
     pending_request_param_->completion()->DidCancelCheckingText();
   }
 
-  pending_request_param_ =
-      std::make_unique<SpellcheckRequest>(text, std::move(completionCallback));
+  pending_request_param_ = std::make_unique<SpellcheckRequest>(
+      ++next_request_id_, text, std::move(completionCallback));
 
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
       FROM_HERE, base::BindOnce(&SpellCheckClient::SpellCheckText,
@@ -175,14 +189,42 @@ void SpellCheckClient::SpellCheckText() {
     }
   }
 
-  // Send out all the words data to the spellchecker to check
-  SpellCheckWords(scope, words);
+  // Only words whose spelling isn't cached need to go to the provider.
+  auto& unchecked_words = pending_request_param_->unchecked_words();
+  auto& misspelled = pending_request_param_->misspelled_words();
+  for (const auto& w : words) {
+    auto cached = word_cache_.Get(w);
+    if (cached == word_cache_.end())
+      unchecked_words.insert(w);
+    else if (!cached->second)
+      misspelled.insert(w);
+  }
+  if (unchecked_words.empty()) {
+    FinishRequest();
+    return;
+  }
+
+  // Send out the remaining words to the spellchecker to check
+  SpellCheckWords(scope, unchecked_words);
 }
 
 void SpellCheckClient::OnSpellCheckDone(
+    int request_id,
     const std::vector<std::u16string>& misspelled_words) {
-  const absl::flat_hash_set<std::u16string> misspelled{misspelled_words.begin(),
-                                                       misspelled_words.end()};
+  // Ignore answers for requests Blink has since replaced.
+  if (!pending_request_param_ || pending_request_param_->id() != request_id)
+    return;
+
+  auto& misspelled = pending_request_param_->misspelled_words();
+  misspelled.insert(misspelled_words.begin(), misspelled_words.end());
+  for (const auto& word : pending_request_param_->unchecked_words())
+    word_cache_.Put(word, !misspelled.contains(word));
+
+  FinishRequest();
+}
+
+void SpellCheckClient::FinishRequest() {
+  const auto& misspelled = pending_request_param_->misspelled_words();
   std::vector<blink::WebTextCheckingResult> results;
 
   auto& word_list = pending_request_param_->wordlist();
@@ -219,7 +261,8 @@ void SpellCheckClient::SpellCheckWords(const SpellCheckScope& scope,
 
   v8::Local<v8::FunctionTemplate> templ = gin_helper::CreateFunctionTemplate(
       isolate_, base::BindRepeating(&SpellCheckClient::OnSpellCheckDone,
-                                    weak_factory_.GetWeakPtr()));
+                                    weak_factory_.GetWeakPtr(),
+                                    pending_request_param_->id()));
   v8::Local<v8::Value> args[] = {gin::ConvertToV8(isolate_, words),
                                  templ->GetFunction(context).ToLocalChecked()};
   // Call javascript with the words and the callback function
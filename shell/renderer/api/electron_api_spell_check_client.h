@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "components/spellcheck/renderer/spellcheck_worditerator.h"
@@ -82,7 +83,11 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
                      std::vector<std::u16string>* contraction_words);
 
   // Callback for the JS API which returns the list of misspelled words.
-  void OnSpellCheckDone(const std::vector<std::u16string>& misspelled_words);
+  void OnSpellCheckDone(int request_id,
+                        const std::vector<std::u16string>& misspelled_words);
+
+  // Reports the misspelled words of the pending request to Blink.
+  void FinishRequest();
 
   // Represents character attributes used for filtering out characters which
   // are not supported by this SpellCheck object.
@@ -100,6 +105,12 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
   // (When Blink sends two or more requests, we cancel the previous
   // requests so we do not have to use vectors.)
   std::unique_ptr<SpellcheckRequest> pending_request_param_;
+  int next_request_id_ = 0;
+
+  // Whether each recently checked word is spelled correctly, so that editing
+  // a long text only sends the provider words it hasn't seen yet. The cache
+  // belongs to this client's provider and language and is dropped with it.
+  base::HashingLRUCache<std::u16string, bool> word_cache_;
 
   raw_ptr<v8::Isolate> isolate_;
   v8::Global<v8::Context> context_;
@@ -17,7 +17,6 @@
 #include "shell/common/heap_snapshot.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
-#include "shell/common/thread_restrictions.h"
 #include "shell/common/v8_util.h"
 #include "shell/renderer/electron_ipc_native.h"
 #include "shell/renderer/electron_render_frame_observer.h"
@@ -131,13 +130,12 @@ void ElectronApiServiceImpl::ReceivePostMessage(
 
 void ElectronApiServiceImpl::TakeHeapSnapshot(
     mojo::ScopedHandle file,
+    mojom::HeapSnapshotCompression compression,
     TakeHeapSnapshotCallback callback) {
   blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
   if (!frame)
     return;
 
-  ScopedAllowBlockingForElectron allow_blocking;
-
   base::ScopedPlatformFile platform_file;
   if (mojo::UnwrapPlatformFile(std::move(file), &platform_file) !=
       MOJO_RESULT_OK) {
@@ -147,10 +145,31 @@ void ElectronApiServiceImpl::TakeHeapSnapshot(
   }
   base::File base_file(std::move(platform_file));
 
+  // The snapshot is taken and serialized here, but compressing and writing
+  // it out happens off the main thread.
   v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
-  bool success = electron::TakeHeapSnapshot(isolate, &base_file);
+  electron::TakeHeapSnapshotInBackground(
+      isolate, std::move(base_file),
+      compression == mojom::HeapSnapshotCompression::kGzip
+          ? HeapSnapshotCompression::kGzip
+          : HeapSnapshotCompression::kNone,
+      std::move(callback));
+}
+
+void ElectronApiServiceImpl::GetHeapSnapshotSummary(
+    GetHeapSnapshotSummaryCallback callback) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame)
+    return;
+
+  v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
+  std::vector<mojom::HeapSnapshotSummaryEntryPtr> entries;
+  for (auto& entry : electron::TakeHeapSnapshotSummary(isolate)) {
+    entries.push_back(mojom::HeapSnapshotSummaryEntry::New(
+        std::move(entry.name), entry.count, entry.self_size));
+  }
 
-  std::move(callback).Run(success);
+  std::move(callback).Run(std::move(entries));
 }
 
 }  // namespace electron
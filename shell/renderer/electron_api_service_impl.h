@@ -38,7 +38,9 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
   void TakeHeapSnapshot(mojo::ScopedHandle file,
+                        mojom::HeapSnapshotCompression compression,
                         TakeHeapSnapshotCallback callback) override;
+  void GetHeapSnapshotSummary(GetHeapSnapshotSummaryCallback callback) override;
   void ProcessPendingMessages();
 
   base::WeakPtr<ElectronApiServiceImpl> GetWeakPtr() {
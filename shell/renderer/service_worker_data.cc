@@ -66,10 +66,18 @@ void ServiceWorkerData::ReceivePostMessage(const std::string& channel,
   NOTIMPLEMENTED();
 }
 
-void ServiceWorkerData::TakeHeapSnapshot(mojo::ScopedHandle file,
-                                         TakeHeapSnapshotCallback callback) {
+void ServiceWorkerData::TakeHeapSnapshot(
+    mojo::ScopedHandle file,
+    mojom::HeapSnapshotCompression compression,
+    TakeHeapSnapshotCallback callback) {
   NOTIMPLEMENTED();
   std::move(callback).Run(false);
 }
 
+void ServiceWorkerData::GetHeapSnapshotSummary(
+    GetHeapSnapshotSummaryCallback callback) {
+  NOTIMPLEMENTED();
+  std::move(callback).Run({});
+}
+
 }  // namespace electron
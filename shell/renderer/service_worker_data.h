@@ -46,7 +46,9 @@ class ServiceWorkerData : public mojom::ElectronRenderer {
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
   void TakeHeapSnapshot(mojo::ScopedHandle file,
+                        mojom::HeapSnapshotCompression compression,
                         TakeHeapSnapshotCallback callback) override;
+  void GetHeapSnapshotSummary(GetHeapSnapshotSummaryCallback callback) override;
 
  private:
   void OnElectronRendererRequest(
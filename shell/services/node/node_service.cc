@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/command_line.h"
+#include "base/functional/bind.h"
 #include "base/no_destructor.h"
 #include "base/process/process.h"
 #include "base/strings/utf_string_conversions.h"
@@ -113,7 +114,12 @@ void NodeService::Initialize(
   g_client_remote.Bind(std::move(client_pending_remote));
   g_client_remote.reset_on_disconnect();
 
-  ParentPort::GetInstance()->Initialize(std::move(params->port));
+  ParentPort::GetInstance()->Initialize(
+      std::move(params->port),
+      base::BindRepeating([](mojo::ScopedDataPipeConsumerHandle consumer) {
+        if (g_client_remote.is_bound())
+          g_client_remote->ReceiveRingBuffer(std::move(consumer));
+      }));
 
   URLLoaderBundle::GetInstance()->SetURLLoaderFactory(
       std::move(params->url_loader_factory),
@@ -188,4 +194,11 @@ void NodeService::Initialize(
   node_bindings_->StartPolling();
 }
 
+void NodeService::ReceiveRingBuffer(
+    mojo::ScopedDataPipeConsumerHandle consumer) {
+  if (!node_env_ || node_env_stopped_)
+    return;
+  ParentPort::GetInstance()->ReceiveRingBuffer(std::move(consumer));
+}
+
 }  // namespace electron
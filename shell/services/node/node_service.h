@@ -64,6 +64,7 @@ class NodeService : public node::mojom::NodeService {
   void Initialize(node::mojom::NodeServiceParamsPtr params,
                   mojo::PendingRemote<node::mojom::NodeServiceClient>
                       client_pending_remote) override;
+  void ReceiveRingBuffer(mojo::ScopedDataPipeConsumerHandle consumer) override;
 
  private:
   // This needs to be initialized first so that it can be destroyed last
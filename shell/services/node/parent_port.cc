@@ -5,11 +5,14 @@
 #include "shell/services/node/parent_port.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/no_destructor.h"
+#include "gin/arguments.h"
 #include "gin/data_object_builder.h"
 #include "gin/object_template_builder.h"
 #include "shell/browser/api/message_port.h"
+#include "shell/browser/api/ring_buffer.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/event_emitter_caller.h"
@@ -31,8 +34,10 @@ ParentPort* ParentPort::GetInstance() {
 ParentPort::ParentPort() = default;
 ParentPort::~ParentPort() = default;
 
-void ParentPort::Initialize(blink::MessagePortDescriptor port) {
+void ParentPort::Initialize(blink::MessagePortDescriptor port,
+                            SendRingBufferCallback send_ring_buffer) {
   port_ = std::move(port);
+  send_ring_buffer_ = std::move(send_ring_buffer);
   connector_ = std::make_unique<mojo::Connector>(
       port_.TakeHandleToEntangleWithEmbedder(),
       mojo::Connector::SINGLE_THREADED_SEND,
@@ -43,17 +48,40 @@ void ParentPort::Initialize(blink::MessagePortDescriptor port) {
       base::BindOnce(&ParentPort::Close, base::Unretained(this)));
 }
 
-void ParentPort::PostMessage(v8::Local<v8::Value> message_value) {
+void ParentPort::PostMessage(gin::Arguments* args) {
   if (!connector_closed_ && connector_ && connector_->is_valid()) {
     v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
     blink::TransferableMessage transferable_message;
 
-    if (!electron::SerializeV8Value(isolate, message_value,
+    v8::Local<v8::Value> message_value = v8::Undefined(isolate);
+    args->GetNext(&message_value);
+
+    v8::Local<v8::Value> transferables;
+    std::vector<gin_helper::Handle<MessagePort>> wrapped_ports;
+    std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+    if (args->GetNext(&transferables) &&
+        !MessagePort::ConvertTransferables(isolate, transferables,
+                                           &wrapped_ports, &array_buffers)) {
+      return;
+    }
+
+    // Serializing detaches the transferred ArrayBuffers, so the ports have
+    // to be checked before that.
+    if (!MessagePort::ValidatePorts(isolate, wrapped_ports))
+      return;
+
+    if (!electron::SerializeV8Value(isolate, message_value, array_buffers,
                                     &transferable_message)) {
       // SerializeV8Value sets an exception.
       return;
     }
 
+    bool threw_exception = false;
+    transferable_message.ports =
+        MessagePort::DisentanglePorts(isolate, wrapped_ports, &threw_exception);
+    if (threw_exception)
+      return;
+
     mojo::Message mojo_message =
         blink::mojom::TransferableMessage::WrapAsMessage(
             std::move(transferable_message));
@@ -61,6 +89,30 @@ void ParentPort::PostMessage(v8::Local<v8::Value> message_value) {
   }
 }
 
+v8::Local<v8::Value> ParentPort::CreateRingBuffer(v8::Isolate* isolate,
+                                                  uint32_t capacity) {
+  mojo::ScopedDataPipeConsumerHandle consumer;
+  auto writer = RingBufferWriter::Create(isolate, capacity, &consumer);
+  if (writer.IsEmpty())
+    return v8::Null(isolate);
+  // The reader closes right away, and so does the writer, when the main
+  // process has gone away.
+  if (send_ring_buffer_)
+    send_ring_buffer_.Run(std::move(consumer));
+  return writer.ToV8();
+}
+
+void ParentPort::ReceiveRingBuffer(
+    mojo::ScopedDataPipeConsumerHandle consumer) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Object> self;
+  if (!GetWrapper(isolate).ToLocal(&self))
+    return;
+  auto reader = RingBufferReader::Create(isolate, std::move(consumer));
+  gin_helper::EmitEvent(isolate, self, "ring-buffer", reader);
+}
+
 void ParentPort::Close() {
   if (!connector_closed_ && connector_->is_valid()) {
     port_.GiveDisentangledHandle(connector_->PassMessagePipe());
@@ -117,6 +169,7 @@ gin::ObjectTemplateBuilder ParentPort::GetObjectTemplateBuilder(
   return gin_helper::DeprecatedWrappable<ParentPort>::GetObjectTemplateBuilder(
              isolate)
       .SetMethod("postMessage", &ParentPort::PostMessage)
+      .SetMethod("createRingBuffer", &ParentPort::CreateRingBuffer)
       .SetMethod("start", &ParentPort::Start)
       .SetMethod("pause", &ParentPort::Pause);
 }
@@ -7,8 +7,10 @@
 
 #include <memory>
 
+#include "base/functional/callback.h"
 #include "mojo/public/cpp/bindings/connector.h"
 #include "mojo/public/cpp/bindings/message.h"
+#include "mojo/public/cpp/system/data_pipe.h"
 #include "shell/common/gin_helper/cleaned_up_at_exit.h"
 #include "shell/common/gin_helper/wrappable.h"
 #include "third_party/blink/public/common/messaging/message_port_descriptor.h"
@@ -44,9 +46,18 @@ class ParentPort final : public gin_helper::DeprecatedWrappable<ParentPort>,
   ParentPort(const ParentPort&) = delete;
   ParentPort& operator=(const ParentPort&) = delete;
 
+  // Sends the reading end of a ring buffer to the main process.
+  using SendRingBufferCallback =
+      base::RepeatingCallback<void(mojo::ScopedDataPipeConsumerHandle)>;
+
   ParentPort();
   ~ParentPort() override;
-  void Initialize(blink::MessagePortDescriptor port);
+  void Initialize(blink::MessagePortDescriptor port,
+                  SendRingBufferCallback send_ring_buffer);
+
+  // Emits 'ring-buffer' with the reading end of a ring buffer created by the
+  // main process.
+  void ReceiveRingBuffer(mojo::ScopedDataPipeConsumerHandle consumer);
 
   // gin_helper::Wrappable
   static gin::DeprecatedWrapperInfo kWrapperInfo;
@@ -57,7 +68,9 @@ class ParentPort final : public gin_helper::DeprecatedWrappable<ParentPort>,
   void Close();
 
  private:
-  void PostMessage(v8::Local<v8::Value> message_value);
+  void PostMessage(gin::Arguments* args);
+  v8::Local<v8::Value> CreateRingBuffer(v8::Isolate* isolate,
+                                        uint32_t capacity);
   void Start();
   void Pause();
 
@@ -67,6 +80,7 @@ class ParentPort final : public gin_helper::DeprecatedWrappable<ParentPort>,
   bool connector_closed_ = false;
   std::unique_ptr<mojo::Connector> connector_;
   blink::MessagePortDescriptor port_;
+  SendRingBufferCallback send_ring_buffer_;
 };
 
 }  // namespace electron
@@ -1223,6 +1223,45 @@ describe('app module', () => {
     });
   });
 
+  describe('compileCache package.json option', () => {
+    const appPath = path.join(__dirname, 'fixtures', 'apps', 'compile-cache');
+    const runApp = () => {
+      const { stdout } = cp.spawnSync(process.execPath, [appPath]);
+      return JSON.parse(stdout.toString());
+    };
+
+    // Node keeps its entries in a subdirectory named after the V8 version.
+    const listCacheFiles = (dir: string): string[] => fs.readdirSync(dir, { withFileTypes: true }).flatMap(entry => {
+      const entryPath = path.join(dir, entry.name);
+      return entry.isDirectory() ? listCacheFiles(entryPath) : [entryPath];
+    });
+
+    it('enables the compile cache under userData', () => {
+      const { cacheDir, userData } = runApp();
+      expect(cacheDir).to.be.a('string');
+      expect(path.dirname(cacheDir)).to.equal(path.join(userData, 'Compile Cache'));
+    });
+
+    it('reuses the cached compiles on the next launch', () => {
+      const { cacheDir } = runApp();
+      fs.rmSync(cacheDir, { recursive: true, force: true });
+
+      runApp();
+      const files = listCacheFiles(cacheDir);
+      expect(files).to.have.lengthOf.at.least(2);
+      // Node only writes the entries it couldn't use, so entries that were
+      // hit keep their timestamps.
+      const past = new Date(2000, 0, 1);
+      for (const file of files) fs.utimesSync(file, past, past);
+
+      runApp();
+      expect(listCacheFiles(cacheDir)).to.deep.equal(files);
+      for (const file of files) {
+        expect(fs.statSync(file).mtime.getTime()).to.equal(past.getTime());
+      }
+    });
+  });
+
   describe('setAppLogsPath(path)', () => {
     it('throws when a relative path is passed', () => {
       const badPath = 'hey/hi/hello';
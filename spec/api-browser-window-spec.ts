@@ -1657,6 +1657,46 @@ describe('BrowserWindow module', () => {
       });
     });
 
+    describe('BrowserWindow.setGeometryEventCoalescing(enable[, options])', () => {
+      it('does not pass details to resize events by default', async () => {
+        const resized = once(w, 'resize');
+        w.setSize(300, 400);
+        const [, details] = await resized;
+        expect(details).to.be.undefined();
+      });
+
+      it('merges resize events and passes the final bounds', async () => {
+        w.setGeometryEventCoalescing(true, { interval: 300 });
+        const events: any[] = [];
+        w.on('resize', (e: any, details: any) => events.push(details));
+        w.setSize(300, 400);
+        w.setSize(310, 410);
+        w.setSize(320, 420);
+        await setTimeout(1000);
+
+        expect(events).to.have.length.within(1, 2);
+        const last = events[events.length - 1];
+        expect(last.bounds).to.deep.equal(w.getBounds());
+        expect(last.coalescedCount).to.be.at.least(1);
+        expectBoundsEqual(w.getSize(), [320, 420]);
+      });
+
+      it('emits events immediately again once disabled', async () => {
+        w.setGeometryEventCoalescing(true, { interval: 60000 });
+        w.setGeometryEventCoalescing(false);
+        const resized = once(w, 'resize');
+        w.setSize(300, 400);
+        const [, details] = await resized;
+        expect(details).to.be.undefined();
+      });
+
+      it('throws for a negative interval', () => {
+        expect(() => {
+          w.setGeometryEventCoalescing(true, { interval: -1 });
+        }).to.throw('interval must be a non-negative number');
+      });
+    });
+
     describe('BrowserWindow.setMinimum/MaximumSize(width, height)', () => {
       it('sets the maximum and minimum size of the window', () => {
         expect(w.getMinimumSize()).to.deep.equal([0, 0]);
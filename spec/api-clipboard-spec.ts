@@ -26,6 +26,47 @@ ifdescribe(process.platform !== 'win32' || process.arch !== 'arm64')('clipboard
     });
   });
 
+  describe('clipboard.writeBitmap()', () => {
+    const width = 4;
+    const height = 2;
+    const bgra = Buffer.alloc(width * height * 4);
+    for (let i = 0; i < bgra.length; i += 4) {
+      bgra.set([i % 256, 0x40, 0x80, 0xff], i);
+    }
+
+    it('writes BGRA pixels', () => {
+      clipboard.writeBitmap(bgra, { width, height });
+      const image = clipboard.readImage();
+      expect(image.getSize()).to.deep.equal({ width, height });
+      expect(image.toBitmap().equals(bgra)).to.be.true();
+    });
+
+    it('writes RGBA pixels from an ArrayBuffer', () => {
+      const arrayBuffer = new ArrayBuffer(bgra.length);
+      const rgba = new Uint8Array(arrayBuffer);
+      for (let i = 0; i < bgra.length; i += 4) {
+        rgba.set([bgra[i + 2], bgra[i + 1], bgra[i], bgra[i + 3]], i);
+      }
+      clipboard.writeBitmap(arrayBuffer, { width, height, pixelFormat: 'rgba' });
+      expect(clipboard.readImage().toBitmap().equals(bgra)).to.be.true();
+    });
+
+    it('throws for invalid arguments', () => {
+      expect(() => {
+        clipboard.writeBitmap('pixels' as any, { width, height });
+      }).to.throw(/buffer must be an ArrayBuffer or ArrayBufferView/);
+      expect(() => {
+        clipboard.writeBitmap(bgra, { width: 0, height });
+      }).to.throw(/width and height must be positive integers/);
+      expect(() => {
+        clipboard.writeBitmap(bgra, { width, height: height + 1 });
+      }).to.throw(/invalid buffer size/);
+      expect(() => {
+        clipboard.writeBitmap(bgra, { width, height, pixelFormat: 'argb' as any });
+      }).to.throw(/pixelFormat must be one of 'bgra' or 'rgba'/);
+    });
+  });
+
   describe('clipboard.readText()', () => {
     it('returns unicode string correctly', () => {
       const text = '千江有水千江月，万里无云万里天';
@@ -155,4 +196,33 @@ ifdescribe(process.platform !== 'win32' || process.arch !== 'arm64')('clipboard
       expect(clipboard.readText()).to.equal(message);
     });
   });
+
+  describe('async reads', () => {
+    it('clipboard.readImageAsync() resolves with a NativeImage', async () => {
+      const i = nativeImage.createFromPath(path.join(fixtures, 'assets', 'logo.png'));
+      clipboard.writeImage(i);
+      const readImage = await clipboard.readImageAsync();
+      expect(readImage.toDataURL()).to.equal(i.toDataURL());
+
+      clipboard.writeText('Not an Image');
+      expect((await clipboard.readImageAsync()).isEmpty()).to.be.true();
+    });
+
+    it('clipboard.readHTMLAsync() resolves with the same markup as readHTML()', async () => {
+      clipboard.writeHTML('<string>Hi</string>');
+      expect(await clipboard.readHTMLAsync()).to.equal(clipboard.readHTML());
+    });
+
+    it('clipboard.availableFormatsAsync() resolves with the same formats as availableFormats()', async () => {
+      clipboard.writeText('formats');
+      expect(await clipboard.availableFormatsAsync()).to.deep.equal(clipboard.availableFormats());
+    });
+
+    it('clipboard.readBufferAsync() resolves with a Buffer', async () => {
+      const buffer = Buffer.from('readBufferAsync', 'utf8');
+      clipboard.writeBuffer('public/utf8-plain-text', buffer);
+      const result = await clipboard.readBufferAsync('public/utf8-plain-text');
+      expect(buffer.equals(result)).to.equal(true);
+    });
+  });
 });
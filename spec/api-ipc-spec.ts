@@ -445,11 +445,6 @@ describe('ipc module', () => {
       it('throws an error when an invalid parameter is sent to postMessage', () => {
         const { port1 } = new MessageChannelMain();
 
-        expect(() => {
-          const buffer = new ArrayBuffer(10) as any;
-          port1.postMessage(null, [buffer]);
-        }).to.throw(/Port at index 0 is not a valid port/);
-
         expect(() => {
           port1.postMessage(null, ['1' as any]);
         }).to.throw(/Port at index 0 is not a valid port/);
@@ -475,6 +470,69 @@ describe('ipc module', () => {
         expect(ev.data).to.equal('hello');
       });
 
+      it('can transfer ArrayBuffers within the process', async () => {
+        const { port1, port2 } = new MessageChannelMain();
+        const buffer = new Uint8Array([1, 2, 3]).buffer;
+        port2.postMessage({ buffer }, [buffer]);
+        expect(buffer.byteLength).to.equal(0);
+        port1.start();
+        const [ev] = await once(port1, 'message');
+        expect([...new Uint8Array(ev.data.buffer)]).to.deep.equal([1, 2, 3]);
+      });
+
+      it('can transfer an ArrayBuffer to a WebContents', async () => {
+        const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+        w.loadURL('about:blank');
+        await w.webContents.executeJavaScript(`(${function () {
+          const { ipcRenderer } = require('electron');
+          ipcRenderer.on('port', ev => {
+            const [port] = ev.ports;
+            port.onmessage = (e) => {
+              const bytes = new Uint8Array(e.data);
+              ipcRenderer.send('done', bytes.length, bytes.every(byte => byte === 7));
+            };
+          });
+        }})()`);
+        const { port1, port2 } = new MessageChannelMain();
+        // Large enough to be sent in shared memory.
+        const buffer = new Uint8Array(1024 * 1024).fill(7).buffer;
+        port1.postMessage(buffer, [buffer]);
+        w.webContents.postMessage('port', null, [port2]);
+        const [, length, filled] = await once(ipcMain, 'done');
+        expect(length).to.equal(1024 * 1024);
+        expect(filled).to.be.true();
+      });
+
+      it('throws when transferring an ArrayBuffer twice', () => {
+        const { port1 } = new MessageChannelMain();
+        const buffer = new ArrayBuffer(10);
+        expect(() => {
+          port1.postMessage(null, [buffer, buffer]);
+        }).to.throw(/ArrayBuffer at index 1 is a duplicate/);
+        expect(buffer.byteLength).to.equal(10);
+
+        port1.postMessage(null, [buffer]);
+        expect(() => {
+          port1.postMessage(null, [buffer]);
+        }).to.throw(/ArrayBuffer at index 0 is already detached/);
+      });
+
+      it('leaves ArrayBuffers usable when a transferred port is invalid', () => {
+        const { port1 } = new MessageChannelMain();
+        const other = new MessageChannelMain();
+        const buffer = new ArrayBuffer(10);
+        expect(() => {
+          port1.postMessage(buffer, [buffer, other.port2, other.port2]);
+        }).to.throw(/Port at index 1 is a duplicate/);
+        expect(buffer.byteLength).to.equal(10);
+
+        port1.postMessage(null, [other.port2]);
+        expect(() => {
+          port1.postMessage(buffer, [buffer, other.port2]);
+        }).to.throw(/Port at index 0 is already neutered/);
+        expect(buffer.byteLength).to.equal(10);
+      });
+
       it('can pass one end to a WebContents', async () => {
         const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
         w.loadURL('about:blank');
@@ -2,6 +2,8 @@ import { nativeImage } from 'electron/common';
 
 import { expect } from 'chai';
 
+import * as fs from 'node:fs';
+import * as os from 'node:os';
 import * as path from 'node:path';
 
 import { ifdescribe, ifit, itremote, useRemoteContext } from './lib/spec-helpers';
@@ -282,6 +284,123 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('toPNGAsync() / toJPEGAsync()', () => {
+    it('encodes the same PNG image as toPNG()', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const resized = image.resize({ width: 100 });
+      const png = await resized.toPNGAsync();
+      expect(png.equals(resized.toPNG())).to.be.true();
+
+      const decoded = nativeImage.createFromBuffer(png);
+      expect(decoded.getSize()).to.deep.equal(resized.getSize());
+    });
+
+    it('supports a scale factor', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const png = await image.toPNGAsync({ scaleFactor: 2.0 });
+      const decoded = nativeImage.createFromBuffer(png, { scaleFactor: 2.0 });
+      expect(decoded.getSize()).to.deep.equal(
+        { width: imageLogo.width / 2, height: imageLogo.height / 2 });
+    });
+
+    it('encodes a JPEG image', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const jpeg = await image.toJPEGAsync(80);
+      expect(jpeg.subarray(0, 2).toString('hex')).to.equal('ffd8');
+      expect(nativeImage.createFromBuffer(jpeg).getSize()).to.deep.equal(image.getSize());
+    });
+  });
+
+  describe('createFromPathAsync(path)', () => {
+    it('loads an image', async () => {
+      const image = await nativeImage.createFromPathAsync(imageLogo.path);
+      expect(image.isEmpty()).to.be.false();
+      expect(image.getSize()).to.deep.equal({ width: imageLogo.width, height: imageLogo.height });
+      expect(image.toBitmap().equals(nativeImage.createFromPath(imageLogo.path).toBitmap())).to.be.true();
+    });
+
+    it('resolves with an empty image for invalid paths', async () => {
+      expect((await nativeImage.createFromPathAsync('does-not-exist.png')).isEmpty()).to.be.true();
+      expect((await nativeImage.createFromPathAsync(__filename)).isEmpty()).to.be.true();
+    });
+  });
+
+  describe('getCacheStats() / setCacheLimit(limit)', () => {
+    const defaultLimit = 32 * 1024 * 1024;
+    let tmpDir: string;
+
+    beforeEach(() => {
+      tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-native-image-cache-'));
+    });
+
+    afterEach(() => {
+      nativeImage.setCacheLimit(defaultLimit);
+      fs.rmSync(tmpDir, { recursive: true, force: true });
+    });
+
+    it('shares decoded images loaded from the same path', () => {
+      const imagePath = path.join(tmpDir, 'logo.png');
+      fs.copyFileSync(imageLogo.path, imagePath);
+
+      const before = nativeImage.getCacheStats();
+      const imageA = nativeImage.createFromPath(imagePath);
+      const imageB = nativeImage.createFromPath(imagePath);
+      const after = nativeImage.getCacheStats();
+
+      expect(after.misses - before.misses).to.equal(1);
+      expect(after.hits - before.hits).to.equal(1);
+      expect(after.size).to.be.at.least(imageLogo.width * imageLogo.height * 4);
+      expect(after.limit).to.equal(defaultLimit);
+      expect(imageA.toBitmap().equals(imageB.toBitmap())).to.be.true();
+    });
+
+    it('decodes the file again once it changes', () => {
+      const imagePath = path.join(tmpDir, 'image.png');
+      fs.copyFileSync(imageLogo.path, imagePath);
+      expect(nativeImage.createFromPath(imagePath).getSize()).to.deep.equal(
+        { width: imageLogo.width, height: imageLogo.height });
+
+      fs.copyFileSync(image1x1.path, imagePath);
+      expect(nativeImage.createFromPath(imagePath).getSize()).to.deep.equal(
+        { width: 1, height: 1 });
+    });
+
+    it('decodes the file again once one of its scale variants changes', () => {
+      const imagePath = path.join(tmpDir, 'image.png');
+      fs.copyFileSync(image1x1.path, imagePath);
+      expect(nativeImage.createFromPath(imagePath).getScaleFactors()).to.deep.equal([1]);
+
+      const variantPath = path.join(tmpDir, 'image@2x.png');
+      fs.copyFileSync(imageLogo.path, variantPath);
+      expect(nativeImage.createFromPath(imagePath).getScaleFactors()).to.deep.equal([1, 2]);
+
+      fs.copyFileSync(image1x1.path, variantPath);
+      expect(nativeImage.createFromPath(imagePath).toBitmap({ scaleFactor: 2 }).length).to.equal(4);
+
+      fs.rmSync(variantPath);
+      expect(nativeImage.createFromPath(imagePath).getScaleFactors()).to.deep.equal([1]);
+    });
+
+    it('evicts cached images when the limit is lowered', () => {
+      nativeImage.createFromPath(imageLogo.path);
+      const before = nativeImage.getCacheStats();
+      expect(before.entries).to.be.at.least(1);
+
+      nativeImage.setCacheLimit(0);
+      const after = nativeImage.getCacheStats();
+      expect(after.entries).to.equal(0);
+      expect(after.size).to.equal(0);
+      expect(after.evictions - before.evictions).to.equal(before.entries);
+
+      expect(nativeImage.createFromPath(imageLogo.path).isEmpty()).to.be.false();
+      expect(nativeImage.getCacheStats().entries).to.equal(0);
+    });
+
+    it('throws for a negative limit', () => {
+      expect(() => nativeImage.setCacheLimit(-1)).to.throw('limit must be a non-negative number');
+    });
+  });
+
   describe('createFromPath(path)', () => {
     it('returns an empty image for invalid paths', () => {
       expect(nativeImage.createFromPath('').isEmpty()).to.be.true();
@@ -389,6 +508,32 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('resizeAsync(options)', () => {
+    it('returns the same sizes as resize()', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      for (const resizeTo of [{}, { width: 269 }, { height: 200 }, { width: 80, height: 65 }, { width: -1, height: -1 }]) {
+        const resized = await image.resizeAsync(resizeTo);
+        expect(resized.getSize()).to.deep.equal(image.resize(resizeTo).getSize());
+      }
+    });
+
+    it('returns an empty image when called on an empty image', async () => {
+      expect((await nativeImage.createEmpty().resizeAsync({ width: 1, height: 1 })).isEmpty()).to.be.true();
+    });
+  });
+
+  describe('resizeBatchAsync(options)', () => {
+    it('returns one resized image per entry', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const images = await image.resizeBatchAsync([{ width: 16 }, { height: 95 }, { width: 0, height: 0 }]);
+      expect(images.map(i => i.getSize())).to.deep.equal([
+        { width: 16, height: 6 },
+        { width: 269, height: 95 },
+        { width: 0, height: 0 }
+      ]);
+    });
+  });
+
   describe('crop(bounds)', () => {
     it('returns an empty image when called on an empty image', () => {
       expect(nativeImage.createEmpty().crop({ width: 1, height: 2, x: 0, y: 0 }).isEmpty()).to.be.true();
@@ -1,4 +1,4 @@
-import { app, session, BrowserWindow, net, ipcMain, Session, webFrameMain, WebFrameMain } from 'electron/main';
+import { app, session, BaseWindow, BrowserWindow, net, ipcMain, Session, webFrameMain, WebFrameMain, WebContentsView } from 'electron/main';
 
 import * as auth from 'basic-auth';
 import { expect } from 'chai';
@@ -12,7 +12,7 @@ import * as https from 'node:https';
 import * as path from 'node:path';
 import { setTimeout } from 'node:timers/promises';
 
-import { defer, ifit, listen } from './lib/spec-helpers';
+import { defer, ifit, listen, waitUntil } from './lib/spec-helpers';
 import { closeAllWindows } from './lib/window-helpers';
 
 describe('session module', () => {
@@ -37,6 +37,16 @@ describe('session module', () => {
       const ses = session.fromPath(tmppath);
       expect(ses.storagePath).to.equal(tmppath);
     });
+
+    it('removes preload code caches left by earlier versions', async () => {
+      const storagePath = fs.mkdtempSync(path.join(app.getPath('temp'), 'electron-session-'));
+      defer(() => fs.rmSync(storagePath, { recursive: true, force: true }));
+      const cacheDir = path.join(storagePath, 'Preload Code Cache');
+      fs.mkdirSync(cacheDir);
+      fs.writeFileSync(path.join(cacheDir, 'stale'), 'cache');
+      session.fromPath(storagePath);
+      await waitUntil(() => !fs.existsSync(cacheDir));
+    });
   });
 
   describe('ses.cookies', () => {
@@ -223,6 +233,103 @@ describe('session module', () => {
       expect(removeEventRemoved).to.equal(true);
     });
 
+    describe('ses.cookies.setChangeBatching(enable[, options])', () => {
+      it('emits filtered changes in batches', async () => {
+        const { cookies } = session.fromPartition(`cookies-batched-${Math.random()}`);
+        cookies.setChangeBatching(true, { interval: 50, name: 'batched' });
+        let changedEvents = 0;
+        cookies.on('changed', () => { changedEvents++; });
+        const changes: any[] = [];
+        const received = new Promise<void>(resolve => {
+          cookies.on('changed-batch', (event, batch) => {
+            changes.push(...batch);
+            if (changes.length >= 3) resolve();
+          });
+        });
+
+        await cookies.set({ url, name: 'batched', value: '1' });
+        await cookies.set({ url, name: 'ignored', value: '1' });
+        await cookies.set({ url, name: 'batched', value: '2' });
+        await received;
+
+        expect(changes.map(c => [c.cookie.value, c.cause, c.removed])).to.deep.equal([
+          ['1', 'explicit', false],
+          ['1', 'overwrite', true],
+          ['2', 'explicit', false]
+        ]);
+        expect(changedEvents).to.equal(0);
+      });
+
+      it('emits changed events again once disabled', async () => {
+        const { cookies } = session.fromPartition(`cookies-batched-${Math.random()}`);
+        cookies.setChangeBatching(true);
+        cookies.setChangeBatching(false);
+        const changed = once(cookies, 'changed');
+        await cookies.set({ url, name, value });
+        const [, cookie, , removed] = await changed;
+        expect(cookie.name).to.equal(name);
+        expect(removed).to.be.false();
+      });
+
+      it('throws for an invalid interval', () => {
+        expect(() => {
+          session.defaultSession.cookies.setChangeBatching(true, { interval: -1 });
+        }).to.throw('interval must be a non-negative number');
+      });
+    });
+
+    describe('ses.cookies.getCached(filter)', () => {
+      it('returns the same cookies as get()', async () => {
+        const { cookies } = session.fromPartition(`cookies-cached-${Math.random()}`);
+        await cookies.getCached({});
+        await cookies.set({ url: 'https://a.example.com/docs', name: 'a', value: '1', secure: true });
+        await cookies.set({ url: 'https://a.example.com', name: 'b', value: '2', domain: '.example.com' });
+        await cookies.set({ url: 'http://other.com', name: 'a', value: '3', httpOnly: true });
+
+        const filters = [
+          {},
+          { name: 'a' },
+          { domain: 'a.example.com' },
+          { domain: 'example.com' },
+          { path: '/docs' },
+          { httpOnly: true },
+          { url: 'https://a.example.com/docs/page' },
+          { url: 'http://a.example.com/' }
+        ];
+        for (const filter of filters) {
+          expect(await cookies.getCached(filter)).to.deep.equal(await cookies.get(filter), JSON.stringify(filter));
+        }
+      });
+
+      it('reflects cookies set and removed through the API', async () => {
+        const { cookies } = session.fromPartition(`cookies-cached-${Math.random()}`);
+        expect(await cookies.getCached({})).to.have.lengthOf(0);
+
+        await cookies.set({ url, name, value: 'first' });
+        expect(await cookies.getCached({ name })).to.have.nested.property('[0].value', 'first');
+
+        await cookies.set({ url, name, value: 'second' });
+        const list = await cookies.getCached({ name });
+        expect(list).to.have.lengthOf(1);
+        expect(list[0].value).to.equal('second');
+
+        await cookies.remove(url, name);
+        expect(await cookies.getCached({ name })).to.have.lengthOf(0);
+      });
+
+      it('shows the latest value while older notifications arrive', async () => {
+        const { cookies } = session.fromPartition(`cookies-cached-${Math.random()}`);
+        await cookies.getCached({});
+        for (let i = 0; i < 20; i++) {
+          await cookies.set({ url, name, value: `${i}` });
+          expect(await cookies.getCached({ name })).to.have.nested.property('[0].value', `${i}`);
+        }
+        await cookies.remove(url, name);
+        await cookies.set({ url, name, value: 'last' });
+        expect(await cookies.getCached({ name })).to.have.nested.property('[0].value', 'last');
+      });
+    });
+
     describe('ses.cookies.flushStore()', async () => {
       it('flushes the cookies to disk', async () => {
         const name = 'foo';
@@ -1764,6 +1871,103 @@ describe('session module', () => {
       expect(handlerDetails!.isMainFrame).to.be.false();
       expect(handlerDetails!.embeddingOrigin).to.equal('file:///');
     });
+
+    describe('when the handler returns a cacheable decision', () => {
+      const readClipboardPermission = (w: BrowserWindow) => {
+        return w.webContents.executeJavaScript(`
+          navigator.permissions.query({name: 'clipboard-read'})
+              .then(permission => permission.state).catch(err => err.message);
+        `, true);
+      };
+
+      let w: BrowserWindow;
+      let ses: Electron.Session;
+      let handlerCalls: number;
+
+      beforeEach(async () => {
+        w = new BrowserWindow({
+          show: false,
+          webPreferences: {
+            partition: `permission-check-cache-${Math.random()}`
+          }
+        });
+        ses = w.webContents.session;
+        handlerCalls = 0;
+        ses.setPermissionCheckHandler((wc, permission) => {
+          if (permission !== 'clipboard-read') return false;
+          handlerCalls++;
+          return { granted: true, cacheFor: 60 * 1000 };
+        });
+        await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      });
+
+      it('answers repeated checks without calling the handler', async () => {
+        for (let i = 0; i < 3; i++) {
+          expect(await readClipboardPermission(w)).to.equal('granted');
+        }
+        expect(handlerCalls).to.equal(1);
+
+        const stats = ses.getPermissionCheckCacheStats();
+        expect(stats.hits).to.be.at.least(2);
+        expect(stats.entries).to.be.at.least(1);
+      });
+
+      it('keeps answering checks after a same-document navigation', async () => {
+        expect(await readClipboardPermission(w)).to.equal('granted');
+        await w.webContents.executeJavaScript('location.hash = "#next"; null');
+        expect(await readClipboardPermission(w)).to.equal('granted');
+        expect(handlerCalls).to.equal(1);
+      });
+
+      it('calls the handler again once the cache is cleared', async () => {
+        expect(await readClipboardPermission(w)).to.equal('granted');
+        ses.clearPermissionCheckCache();
+        expect(ses.getPermissionCheckCacheStats().entries).to.equal(0);
+        expect(await readClipboardPermission(w)).to.equal('granted');
+        expect(handlerCalls).to.equal(2);
+      });
+
+      it('does not cache decisions returned as booleans', async () => {
+        ses.setPermissionCheckHandler((wc, permission) => {
+          if (permission !== 'clipboard-read') return false;
+          handlerCalls++;
+          return true;
+        });
+        expect(await readClipboardPermission(w)).to.equal('granted');
+        expect(await readClipboardPermission(w)).to.equal('granted');
+        expect(handlerCalls).to.equal(2);
+        expect(ses.getPermissionCheckCacheStats().entries).to.equal(0);
+      });
+
+      it('does not share decisions between iframes of different origins', async () => {
+        const origins = new Set<string>();
+        ses.setPermissionCheckHandler((wc, permission, requestingOrigin, details) => {
+          if (permission !== 'media') return false;
+          const { securityOrigin } = details as { securityOrigin?: string };
+          if (securityOrigin) origins.add(new URL(securityOrigin).origin);
+          return { granted: securityOrigin?.startsWith('https://a.myfakesite') ?? false, cacheFor: 60 * 1000 };
+        });
+        ses.protocol.interceptStringProtocol('https', (req, cb) => {
+          cb('<html><body></body></html>');
+        });
+        defer(() => ses.protocol.uninterceptProtocol('https'));
+
+        await w.loadURL('https://main.myfakesite/');
+        for (const origin of ['https://a.myfakesite', 'https://b.myfakesite']) {
+          w.webContents.executeJavaScript(`
+            var iframe = document.createElement('iframe');
+            iframe.src = '${origin}/';
+            iframe.allow = 'camera; microphone';
+            document.body.appendChild(iframe);
+            null;
+          `);
+          const [,, frameProcessId, frameRoutingId] = await once(w.webContents, 'did-frame-finish-load');
+          await webFrameMain.fromId(frameProcessId, frameRoutingId)!.executeJavaScript(
+            'navigator.mediaDevices.enumerateDevices().then(() => null)', true);
+        }
+        expect([...origins]).to.include.members(['https://a.myfakesite', 'https://b.myfakesite']);
+      });
+    });
   });
 
   describe('ses.isPersistent()', () => {
@@ -1859,6 +2063,54 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.setWebContentsPool()', () => {
+    afterEach(closeAllWindows);
+
+    it('hands out ready WebContents whose renderer is reused for the first navigation', async () => {
+      const ses = session.fromPartition(`web-contents-pool-${Math.random()}`);
+      const webPreferences = { sandbox: true };
+      ses.setWebContentsPool({ size: 1, webPreferences });
+      defer(() => ses.setWebContentsPool({ size: 0 }));
+      await waitUntil(() => ses.getWebContentsPoolStats().ready === 1);
+
+      const webContents = ses.takePooledWebContents(webPreferences);
+      expect(webContents).to.not.be.null();
+      const pid = webContents!.getOSProcessId();
+
+      const w = new BaseWindow({ show: false });
+      const view = new WebContentsView({ webContents: webContents!, webPreferences });
+      w.contentView.addChildView(view);
+      await view.webContents.loadFile(path.join(fixtures, 'pages', 'base-page.html'));
+      expect(view.webContents.getOSProcessId()).to.equal(pid);
+
+      expect(ses.getWebContentsPoolStats()).to.include({ size: 1, hits: 1 });
+    });
+
+    it('counts misses when no WebContents is ready', () => {
+      const ses = session.fromPartition(`web-contents-pool-${Math.random()}`);
+      ses.setWebContentsPool({ size: 1 });
+      defer(() => ses.setWebContentsPool({ size: 0 }));
+      expect(ses.takePooledWebContents()).to.be.null();
+      expect(ses.getWebContentsPoolStats()).to.include({ hits: 0, misses: 1 });
+    });
+
+    it('does not hand out WebContents created with other webPreferences', async () => {
+      const ses = session.fromPartition(`web-contents-pool-${Math.random()}`);
+      ses.setWebContentsPool({ size: 1, webPreferences: { sandbox: true } });
+      defer(() => ses.setWebContentsPool({ size: 0 }));
+      await waitUntil(() => ses.getWebContentsPoolStats().ready === 1);
+
+      expect(ses.takePooledWebContents({ sandbox: false })).to.be.null();
+      expect(ses.takePooledWebContents()).to.be.null();
+      expect(ses.getWebContentsPoolStats()).to.include({ ready: 1, hits: 0, misses: 2 });
+      expect(ses.takePooledWebContents({ sandbox: true })).to.not.be.null();
+    });
+
+    it('validates the pool size', () => {
+      expect(() => session.defaultSession.setWebContentsPool({ size: -1 })).to.throw(/non-negative integer/);
+    });
+  });
+
   describe('ses.setSSLConfig()', () => {
     it('can disable cipher suites', async () => {
       const ses = session.fromPartition('' + Math.random());
@@ -2028,5 +2280,87 @@ describe('session module', () => {
       expect((await cookies.get({ url: 'https://example.com/', name: 'testdotcom' })).length).to.be.greaterThan(0);
       expect((await cookies.get({ url: 'https://example.org/', name: 'testdotorg' })).length).to.equal(0);
     });
+
+    it('clears incrementally and reports progress', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true } });
+      await w.loadFile(path.join(fixtures, 'api', 'localstorage.html'));
+
+      expect(await w.webContents.executeJavaScript('localStorage.length')).to.be.greaterThan(0);
+
+      const progress: [number, number][] = [];
+      await w.webContents.session.clearData({
+        dataTypes: ['cookies', 'localStorage'],
+        incremental: {
+          budget: 0.9,
+          onProgress: ({ completedSteps, totalSteps }) => progress.push([completedSteps, totalSteps])
+        }
+      });
+
+      expect(progress).to.deep.equal([[1, 2], [2, 2]]);
+      expect(await w.webContents.executeJavaScript('localStorage.length')).to.equal(0);
+    });
+
+    it('stops an incremental clear when aborted and returns what remains', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+
+      const controller = new AbortController();
+      const origins = ['https://a.example.com', 'https://b.example.com', 'https://c.example.com'];
+      const clear = w.webContents.session.clearData({
+        origins,
+        incremental: {
+          originsPerStep: 1,
+          signal: controller.signal,
+          onProgress: () => controller.abort()
+        }
+      });
+
+      const error = await clear.then(() => null, error => error);
+      expect(error).to.have.property('name', 'AbortError');
+      expect(error.remaining.origins).to.deep.equal(origins.slice(1));
+      expect(error.remaining.incremental).to.include({ originsPerStep: 1 });
+      expect(error.remaining.incremental).to.not.have.property('signal');
+      await w.webContents.session.clearData(error.remaining);
+    });
+
+    it('only resumes the steps an aborted incremental clear did not complete', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+
+      const controller = new AbortController();
+      const clear = w.webContents.session.clearData({
+        incremental: {
+          budget: 1,
+          signal: controller.signal,
+          onProgress: ({ completedSteps, totalSteps }) => {
+            if (completedSteps === totalSteps - 1) controller.abort();
+          }
+        }
+      });
+
+      const error = await clear.then(() => null, error => error);
+      expect(error).to.have.property('name', 'AbortError');
+      const progress: [number, number][] = [];
+      await w.webContents.session.clearData({
+        ...error.remaining,
+        incremental: {
+          ...error.remaining.incremental,
+          onProgress: ({ completedSteps, totalSteps }: { completedSteps: number, totalSteps: number }) => progress.push([completedSteps, totalSteps])
+        }
+      });
+      expect(progress).to.deep.equal([[1, 1]]);
+    });
+
+    it('rejects an invalid incremental budget', async () => {
+      await expect(session.defaultSession.clearData({ incremental: { budget: 0 } })).to.eventually.be.rejectedWith(/budget must be/);
+    });
+
+    it('rejects an invalid originsPerStep', async () => {
+      const origins = ['https://a.example.com', 'https://b.example.com'];
+      for (const originsPerStep of [0, -1, 1.5, NaN]) {
+        await expect(session.defaultSession.clearData({ origins, incremental: { originsPerStep } }))
+          .to.eventually.be.rejectedWith(TypeError, /originsPerStep must be a positive integer/);
+      }
+    });
   });
 });
@@ -12,7 +12,7 @@ import { setImmediate } from 'node:timers/promises';
 import { pathToFileURL } from 'node:url';
 
 import { respondOnce, randomString, kOneKiloByte } from './lib/net-helpers';
-import { ifit, startRemoteControlApp } from './lib/spec-helpers';
+import { ifit, startRemoteControlApp, waitUntil } from './lib/spec-helpers';
 import { closeWindow } from './lib/window-helpers';
 
 const fixturesPath = path.resolve(__dirname, 'fixtures', 'api', 'utility-process');
@@ -402,6 +402,87 @@ describe('utilityProcess module', () => {
       await exit;
     });
 
+    it('transfers ArrayBuffers in both directions', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'transfer-array-buffer.js'));
+      await once(child, 'spawn');
+      const buffer = new Uint8Array([1, 2, 3, 4]).buffer;
+      child.postMessage(buffer, [buffer]);
+      expect(buffer.byteLength).to.equal(0);
+      const [data] = await once(child, 'message');
+      expect([...new Uint8Array(data)]).to.deep.equal([4, 3, 2, 1]);
+      // The child's copy was detached when it was sent back.
+      const [byteLength] = await once(child, 'message');
+      expect(byteLength).to.equal(0);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
+
+    it('streams bytes through ring buffers in both directions', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'ring-buffer-echo.js'));
+      await once(child, 'spawn');
+      const writer = child.createRingBuffer({ capacity: 1024 })!;
+      const sent = new Uint8Array(1000).map((_, i) => i % 251);
+      for (let i = 0; i < sent.length; i += 100) {
+        expect(writer.write(sent.subarray(i, i + 100))).to.be.true();
+      }
+      writer.close();
+      const [reader] = await once(child, 'ring-buffer');
+      const received: number[] = [];
+      const chunk = new Uint8Array(128);
+      reader.on('readable', () => {
+        let length;
+        while ((length = reader.read(chunk)) > 0) {
+          received.push(...chunk.subarray(0, length));
+        }
+      });
+      await once(reader, 'close');
+      expect(received).to.deep.equal([...sent]);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
+
+    it('keeps ring buffers created before a listener is added', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'ring-buffer-early.js'));
+      await once(child, 'message');
+      const [reader] = await once(child, 'ring-buffer');
+      const chunk = new Uint8Array(16);
+      expect(reader.read(chunk)).to.equal(3);
+      expect([...chunk.subarray(0, 3)]).to.deep.equal([1, 2, 3]);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
+
+    it('queues ring buffer writes that do not fit and emits drain once', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'ring-buffer-echo.js'));
+      await once(child, 'spawn');
+      const writer = child.createRingBuffer({ capacity: 1024 })!;
+      let drains = 0;
+      writer.on('drain', () => { drains++; });
+      const sent = new Uint8Array(3000).map((_, i) => i % 251);
+      expect(writer.write(sent.subarray(0, 1000))).to.be.true();
+      expect(writer.write(sent.subarray(1000))).to.be.false();
+      const [reader] = await once(child, 'ring-buffer');
+      const received: number[] = [];
+      const chunk = new Uint8Array(512);
+      reader.on('readable', () => {
+        let length;
+        while ((length = reader.read(chunk)) > 0) {
+          received.push(...chunk.subarray(0, length));
+        }
+      });
+      await once(writer, 'drain');
+      writer.close();
+      await once(reader, 'close');
+      expect(drains).to.equal(1);
+      expect(received).to.deep.equal([...sent]);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
+
     it('supports queuing messages on the receiving end', async () => {
       const child = utilityProcess.fork(path.join(fixturesPath, 'post-message-queue.js'));
       const p = once(child, 'spawn');
@@ -428,6 +509,128 @@ describe('utilityProcess module', () => {
     });
   });
 
+  describe('createPool() API', () => {
+    it('runs jobs on warm workers', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker.js'), { size: 2 });
+      try {
+        const replies = await Promise.all([1, 2, 3, 4].map(n => pool.run(n)));
+        expect(replies.map(reply => reply.result)).to.deep.equal([2, 4, 6, 8]);
+        const metrics = pool.getMetrics();
+        expect(metrics.workers).to.equal(2);
+        // Which worker runs which job depends on how fast they start, but
+        // every job runs on one of the pool's warm workers.
+        const pids = metrics.workerMetrics.map(worker => worker.pid);
+        for (const reply of replies) {
+          expect(pids).to.include(reply.pid);
+        }
+        expect(metrics.queuedJobs).to.equal(0);
+        expect(metrics.completedJobs).to.equal(4);
+        expect(metrics.averageJobLatency).to.be.greaterThan(0);
+        expect(metrics.workerMetrics.map(worker => worker.completedJobs).reduce((a, b) => a + b)).to.equal(4);
+      } finally {
+        await pool.close();
+      }
+    });
+
+    it('rejects a job that times out and replaces its worker', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker.js'), { size: 1 });
+      try {
+        const { pid } = await pool.run(1);
+        await expect(pool.run('hang', { timeout: 100 })).to.eventually.be.rejectedWith(/timed out after 100 ms/);
+        const reply = await pool.run(2);
+        expect(reply.result).to.equal(4);
+        expect(reply.pid).to.not.equal(pid);
+        await expect(pool.run(1, { timeout: 0 })).to.eventually.be.rejectedWith(TypeError, /timeout must be a positive integer/);
+      } finally {
+        await pool.close();
+      }
+    });
+
+    it('recycles workers after maxJobsPerWorker jobs', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker.js'), { size: 1, maxJobsPerWorker: 1 });
+      try {
+        const first = await pool.run(1);
+        const second = await pool.run(2);
+        expect(second.pid).to.not.equal(first.pid);
+        expect(pool.getMetrics().recycledWorkers).to.equal(2);
+      } finally {
+        await pool.close();
+      }
+    });
+
+    it('rejects the job of a worker that exits and replaces it', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker.js'), { size: 1 });
+      try {
+        await expect(pool.run('exit')).to.eventually.be.rejectedWith(/exited with code 1/);
+        expect((await pool.run(21)).result).to.equal(42);
+        expect(pool.getMetrics().failedJobs).to.equal(1);
+      } finally {
+        await pool.close();
+      }
+    });
+
+    it('stops replacing workers that keep exiting before completing a job', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'exception.js'), { size: 1 });
+      try {
+        await expect(pool.run(1)).to.eventually.be.rejected();
+        await waitUntil(() => pool.getMetrics().workers === 0);
+        await expect(pool.run(1)).to.eventually.be.rejectedWith(/The pool has no workers left/);
+      } finally {
+        await pool.close();
+      }
+    });
+
+    it('runs higher priority jobs first', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker.js'), { size: 1 });
+      try {
+        const order: number[] = [];
+        const busy = pool.run({ delay: 200, value: 0 });
+        const low = pool.run(1, { priority: 'low' }).then(() => order.push(1));
+        const high = pool.run(2, { priority: 'high' }).then(() => order.push(2));
+        await Promise.all([busy, low, high]);
+        expect(order).to.deep.equal([2, 1]);
+      } finally {
+        await pool.close();
+      }
+    });
+
+    it('cancels jobs with an AbortSignal', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker.js'), { size: 1 });
+      try {
+        const busy = pool.run({ delay: 200, value: 0 });
+        const controller = new AbortController();
+        const queued = pool.run(1, { signal: controller.signal });
+        controller.abort();
+        await expect(queued).to.eventually.be.rejectedWith(/abort/i);
+        await busy;
+        const metrics = pool.getMetrics();
+        expect(metrics.cancelledJobs).to.equal(1);
+        expect(metrics.completedJobs).to.equal(1);
+      } finally {
+        await pool.close();
+      }
+    });
+
+    it('rejects jobs beyond maxQueuedJobs until drained', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker.js'), { size: 1, maxQueuedJobs: 1 });
+      try {
+        const queued = pool.run({ delay: 100, value: 1 });
+        await expect(pool.run(2)).to.eventually.be.rejectedWith(/The job queue is full/);
+        await once(pool, 'drain');
+        expect((await queued).result).to.equal(2);
+        expect((await pool.run(3)).result).to.equal(6);
+      } finally {
+        await pool.close();
+      }
+    });
+
+    it('rejects jobs once closed', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker.js'), { size: 1 });
+      await pool.close();
+      await expect(pool.run(1)).to.eventually.be.rejectedWith(/The pool is closed/);
+    });
+  });
+
   describe('behavior', () => {
     it('supports starting the v8 inspector with --inspect-brk', (done) => {
       const child = utilityProcess.fork(path.join(fixturesPath, 'log.js'), [], {
@@ -1,4 +1,4 @@
-import { BaseWindow, View } from 'electron/main';
+import { BaseWindow, View, WebContentsView } from 'electron/main';
 
 import { expect } from 'chai';
 
@@ -80,6 +80,131 @@ describe('View', () => {
     v.setBorderRadius(-9999999);
   });
 
+  describe('view.setLayout()', () => {
+    it('lays out children in a grid', () => {
+      const host = new View();
+      host.setLayout({
+        type: 'grid',
+        columns: [100, { flex: 1 }],
+        rows: [{ flex: 1 }, 50],
+        columnGap: 10
+      });
+      const [a, b, c] = [new View(), new View(), new View()];
+      for (const v of [a, b, c]) host.addChildView(v);
+      a.setLayoutConstraints({ column: 0, row: 0 });
+      b.setLayoutConstraints({ column: 1, row: 0, rowSpan: 2 });
+      c.setLayoutConstraints({ column: 0, row: 1 });
+      host.setBounds({ x: 0, y: 0, width: 400, height: 300 });
+
+      expect(a.getBounds()).to.deep.equal({ x: 0, y: 0, width: 100, height: 250 });
+      expect(b.getBounds()).to.deep.equal({ x: 110, y: 0, width: 290, height: 300 });
+      expect(c.getBounds()).to.deep.equal({ x: 0, y: 250, width: 100, height: 50 });
+    });
+
+    it('keeps flexible grid tracks within their size limits', () => {
+      const host = new View();
+      host.setLayout({
+        type: 'grid',
+        columns: [{ flex: 1, maximumSize: 100 }, { flex: 1, minimumSize: 50 }]
+      });
+      const [left, right] = [new View(), new View()];
+      host.addChildView(left);
+      host.addChildView(right);
+      right.setLayoutConstraints({ column: 1 });
+      host.setBounds({ x: 0, y: 0, width: 400, height: 300 });
+      expect(left.getBounds().width).to.equal(100);
+      expect(right.getBounds()).to.deep.equal({ x: 100, y: 0, width: 300, height: 300 });
+
+      host.setBounds({ x: 0, y: 0, width: 80, height: 300 });
+      expect(right.getBounds().width).to.equal(50);
+    });
+
+    it('anchors children to the edges of the parent', () => {
+      const host = new View();
+      host.setLayout({ type: 'anchor' });
+      const [toolbar, badge] = [new View(), new View()];
+      host.addChildView(toolbar);
+      host.addChildView(badge);
+      toolbar.setLayoutConstraints({ left: 0, right: 0, top: 0, height: 30 });
+      badge.setLayoutConstraints({ right: 10, bottom: 10, width: 50, height: 20 });
+      host.setBounds({ x: 0, y: 0, width: 400, height: 300 });
+      expect(toolbar.getBounds()).to.deep.equal({ x: 0, y: 0, width: 400, height: 30 });
+      expect(badge.getBounds()).to.deep.equal({ x: 340, y: 270, width: 50, height: 20 });
+
+      host.setBounds({ x: 0, y: 0, width: 600, height: 400 });
+      expect(toolbar.getBounds().width).to.equal(600);
+      expect(badge.getBounds()).to.deep.equal({ x: 540, y: 370, width: 50, height: 20 });
+    });
+
+    it('uses the preferred size of children anchored to a single edge', () => {
+      const host = new View();
+      host.setLayout({ type: 'anchor' });
+      const child = new View();
+      host.addChildView(child);
+      child.setLayoutConstraints({ left: 0, right: 0, top: 0, height: 30 });
+      host.setBounds({ x: 0, y: 0, width: 400, height: 300 });
+      expect(child.getBounds().width).to.equal(400);
+
+      // The previous stretched width isn't reused.
+      child.setLayoutConstraints({ right: 0, top: 0, height: 30, minimumWidth: 20 });
+      host.setBounds({ x: 0, y: 0, width: 500, height: 300 });
+      expect(child.getBounds()).to.deep.equal({ x: 480, y: 0, width: 20, height: 30 });
+    });
+
+    it('rejects negative sizes and spans', () => {
+      const host = new View();
+      expect(() => {
+        host.setLayout({ type: 'grid', columns: [-10] });
+      }).to.throw(/Invalid columns/);
+      expect(() => {
+        host.setLayout({ type: 'grid', rows: [{ flex: 1, minimumSize: -1 }] });
+      }).to.throw(/Invalid rows/);
+      expect(() => {
+        host.setLayout({ type: 'grid', columnGap: -1 });
+      }).to.throw(/Invalid gap/);
+
+      const child = new View();
+      expect(() => {
+        child.setLayoutConstraints({ columnSpan: 0 });
+      }).to.throw(/Invalid layout constraints/);
+      expect(() => {
+        child.setLayoutConstraints({ width: -1 });
+      }).to.throw(/Invalid layout constraints/);
+      expect(() => {
+        child.setLayoutConstraints({ left: -10, width: 50 });
+      }).not.to.throw();
+    });
+
+    it('keeps a child\'s own flex behavior unless the constraints set one', () => {
+      const host = new View();
+      host.setLayout({ type: 'flex' });
+      const child = new WebContentsView();
+      host.addChildView(child);
+      host.setBounds({ x: 0, y: 0, width: 400, height: 300 });
+      expect(child.getBounds().width).to.equal(400);
+
+      child.setLayoutConstraints({ minimumWidth: 100 });
+      host.setBounds({ x: 0, y: 0, width: 500, height: 300 });
+      expect(child.getBounds().width).to.equal(500);
+
+      child.setLayoutConstraints({ flex: 1, maximumWidth: 200 });
+      host.setBounds({ x: 0, y: 0, width: 600, height: 300 });
+      expect(child.getBounds().width).to.equal(200);
+
+      child.setLayoutConstraints(null);
+      host.setBounds({ x: 0, y: 0, width: 700, height: 300 });
+      expect(child.getBounds().width).to.equal(700);
+      child.webContents.close();
+    });
+
+    it('throws for an invalid layout type', () => {
+      const host = new View();
+      expect(() => {
+        host.setLayout({ type: 'table' as any });
+      }).to.throw(/Invalid layout type/);
+    });
+  });
+
   describe('view.getVisible|setVisible', () => {
     it('is visible by default', () => {
       const v = new View();
@@ -11,6 +11,7 @@ import * as os from 'node:os';
 import * as path from 'node:path';
 import { setTimeout } from 'node:timers/promises';
 import * as url from 'node:url';
+import * as zlib from 'node:zlib';
 
 import { ifdescribe, defer, waitUntil, listen, ifit } from './lib/spec-helpers';
 import { cleanupWebContents, closeAllWindows } from './lib/window-helpers';
@@ -2512,6 +2513,64 @@ describe('webContents module', () => {
       const promise = w.webContents.takeHeapSnapshot(filePath);
       return expect(promise).to.be.eventually.rejectedWith(Error, 'Failed to take heap snapshot with nonexistent render frame');
     });
+
+    it('writes a gzip-compressed snapshot', async () => {
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          sandbox: true
+        }
+      });
+
+      await w.loadURL('about:blank');
+
+      const filePath = path.join(app.getPath('temp'), 'test.heapsnapshot.gz');
+      defer(() => fs.promises.rm(filePath, { force: true }));
+
+      await w.webContents.takeHeapSnapshot(filePath, { compression: 'gzip' });
+      const snapshot = JSON.parse(zlib.gunzipSync(await fs.promises.readFile(filePath)).toString());
+      expect(snapshot).to.have.property('snapshot');
+      expect(snapshot).to.have.property('nodes');
+    });
+
+    it('fails with invalid compression', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+
+      const filePath = path.join(app.getPath('temp'), 'test.heapsnapshot');
+      const promise = w.webContents.takeHeapSnapshot(filePath, { compression: 'brotli' as any });
+      return expect(promise).to.be.eventually.rejectedWith(Error, /Invalid compression/);
+    });
+  });
+
+  describe('getHeapSnapshotSummary()', () => {
+    afterEach(closeAllWindows);
+
+    it('returns heap objects grouped by constructor', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      await w.webContents.executeJavaScript(`
+        class SummaryTestObject {}
+        window.kept = Array.from({ length: 100 }, () => new SummaryTestObject());
+      `);
+
+      const summary = await w.webContents.getHeapSnapshotSummary();
+      expect(summary).to.be.an('array').that.is.not.empty();
+      const entry = summary.find(e => e.name === 'SummaryTestObject');
+      expect(entry).to.not.be.undefined();
+      expect(entry!.count).to.be.at.least(100);
+      expect(entry!.selfSize).to.be.greaterThan(0);
+      for (let i = 1; i < summary.length; i++) {
+        expect(summary[i - 1].selfSize).to.be.at.least(summary[i].selfSize);
+      }
+    });
+
+    it('fails with invalid render process', async () => {
+      const w = new BrowserWindow({ show: false });
+      w.webContents.destroy();
+      const promise = w.webContents.getHeapSnapshotSummary();
+      return expect(promise).to.be.eventually.rejectedWith(Error, 'Failed to get heap snapshot summary with nonexistent render frame');
+    });
   });
 
   describe('setBackgroundThrottling()', () => {
@@ -2703,6 +2762,63 @@ describe('webContents module', () => {
       expect(data).to.be.an.instanceof(Buffer).that.is.not.empty();
     });
 
+    it('runs queued jobs after one of them fails', async () => {
+      await w.loadURL('data:text/html,<h1>Hello, World!</h1>');
+
+      const failing = w.webContents.printToPDF({ pageRanges: '5-6' });
+      const queued = w.webContents.printToPDF({});
+      await expect(failing).to.eventually.be.rejected();
+      expect(await queued).to.be.an.instanceof(Buffer).that.is.not.empty();
+    });
+
+    it('can print to PDFs in several webContents at once', async () => {
+      const other = new BrowserWindow({ show: false });
+      await Promise.all([
+        w.loadURL('data:text/html,<h1>Hello, World!</h1>'),
+        other.loadURL('data:text/html,<h1>Hello, Other!</h1>')
+      ]);
+
+      const [first, second] = await Promise.all([
+        w.webContents.printToPDF({}),
+        other.webContents.printToPDF({})
+      ]);
+      expect(containsText((await readPDF(first)).textContent, /Hello, World!/)).to.be.true();
+      expect(containsText((await readPDF(second)).textContent, /Hello, Other!/)).to.be.true();
+    });
+
+    describe('printToPDFFile()', () => {
+      let tmpDir: string;
+
+      beforeEach(async () => {
+        tmpDir = await fs.promises.mkdtemp(path.resolve(os.tmpdir(), 'e-spec-printtopdffile-'));
+      });
+
+      afterEach(async () => {
+        await fs.promises.rm(tmpDir, { force: true, recursive: true });
+      });
+
+      it('writes the PDF to the file', async () => {
+        await w.loadURL('data:text/html,<h1>Hello, World!</h1>');
+
+        const pdfPath = path.join(tmpDir, 'test.pdf');
+        await w.webContents.printToPDFFile(pdfPath, { landscape: true });
+        const pdfInfo = await readPDF(await fs.promises.readFile(pdfPath));
+        expect(pdfInfo.numPages).to.equal(1);
+        expect(containsText(pdfInfo.textContent, /Hello, World!/)).to.be.true();
+      });
+
+      it('rejects relative paths', async () => {
+        await w.loadURL('data:text/html,<h1>Hello, World!</h1>');
+        await expect(w.webContents.printToPDFFile('test.pdf')).to.eventually.be.rejectedWith('filePath must be an absolute path');
+      });
+
+      it('rejects when the file cannot be written', async () => {
+        await w.loadURL('data:text/html,<h1>Hello, World!</h1>');
+        const pdfPath = path.join(tmpDir, 'missing', 'test.pdf');
+        await expect(w.webContents.printToPDFFile(pdfPath)).to.eventually.be.rejectedWith(/Failed to write PDF/);
+      });
+    });
+
     type PageSizeString = Exclude<Required<Electron.PrintToPDFOptions>['pageSize'], Electron.Size>;
 
     it('with custom page sizes', async () => {
@@ -1289,6 +1289,17 @@ describe('chrome extensions', () => {
         expect(updated[1]).to.equal('HEY HEY HEY');
       });
 
+      it('executeScript with files', async () => {
+        await w.loadURL(url);
+
+        const message = { method: 'executeScriptFiles' };
+        w.webContents.executeJavaScript(`window.postMessage('${JSON.stringify(message)}', '*')`);
+
+        // The second injection is served from the loaded files.
+        const [{ message: responseString }] = await once(w.webContents, 'console-message');
+        expect(JSON.parse(responseString)).to.deep.equal([1, 2]);
+      });
+
       it('registerContentScripts', async () => {
         await w.loadURL(url);
 
@@ -0,0 +1,14 @@
+process.parentPort.on('message', (e) => {
+  const [reply] = e.ports;
+  if (e.data === 'exit') {
+    process.exit(1);
+  }
+  if (e.data === 'hang') {
+    return;
+  }
+  if (typeof e.data === 'object') {
+    setTimeout(() => reply.postMessage({ pid: process.pid, result: e.data.value * 2 }), e.data.delay);
+    return;
+  }
+  reply.postMessage({ pid: process.pid, result: e.data * 2 });
+});
@@ -0,0 +1,3 @@
+const writer = process.parentPort.createRingBuffer({ capacity: 1024 });
+writer.write(new Uint8Array([1, 2, 3]));
+process.parentPort.postMessage('written');
@@ -0,0 +1,11 @@
+process.parentPort.on('ring-buffer', (reader) => {
+  const writer = process.parentPort.createRingBuffer({ capacity: 1024 });
+  const chunk = new Uint8Array(256);
+  reader.on('readable', () => {
+    let length;
+    while ((length = reader.read(chunk)) > 0) {
+      writer.write(chunk.subarray(0, length));
+    }
+  });
+  reader.on('close', () => writer.close());
+});
@@ -0,0 +1,15 @@
+const { app } = require('electron');
+
+const { flushCompileCache, getCompileCacheDir } = require('node:module');
+
+// Compiled through the cache too, so that there's more than the entry point.
+require('./helper');
+
+app.whenReady().then(() => {
+  flushCompileCache();
+  process.stdout.write(JSON.stringify({
+    cacheDir: getCompileCacheDir(),
+    userData: app.getPath('userData')
+  }));
+  app.quit();
+});
@@ -20,6 +20,20 @@ const handleRequest = async (request, sender, sendResponse) => {
       break;
     }
 
+    case 'executeScriptFiles': {
+      const results = [];
+      for (let i = 0; i < 2; i++) {
+        const [{ result }] = await chrome.scripting.executeScript({
+          target: { tabId },
+          files: ['inject.js']
+        });
+        results.push(result);
+      }
+
+      sendResponse(results);
+      break;
+    }
+
     case 'globalParams' : {
       await chrome.scripting.executeScript({
         target: { tabId },
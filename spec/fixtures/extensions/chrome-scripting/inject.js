@@ -0,0 +1,2 @@
+window.injectCount = (window.injectCount || 0) + 1;
+window.injectCount;
@@ -10,6 +10,11 @@ const map = {
       console.log(JSON.stringify(response));
     });
   },
+  executeScriptFiles () {
+    chrome.runtime.sendMessage({ method: 'executeScriptFiles' }, response => {
+      console.log(JSON.stringify(response));
+    });
+  },
   registerContentScripts () {
     chrome.runtime.sendMessage({ method: 'registerContentScripts' }, response => {
       console.log(JSON.stringify(response));
@@ -220,3 +220,59 @@ ifdescribe(isTestingBindingAvailable())('logging', () => {
     expect(stderr).not.to.match(/TEST_INFO_LOG/);
   });
 });
+
+describe('app.log()', () => {
+  it('writes structured messages to the log file', async () => {
+    const logFilePath = path.join(app.getPath('temp'), 'test-log-file-' + uuid.v4());
+    const rc = await startRemoteControlApp(['--enable-logging', '--log-file=' + logFilePath]);
+    rc.remotely(() => {
+      const { app } = require('electron');
+      app.log('APP_LOG', { level: 'warning', category: 'spec', fields: { answer: 42, name: 'a b' } });
+      setTimeout(() => { app.quit(); });
+    });
+    await once(rc.process, 'exit');
+    const contents = await fs.readFile(logFilePath, 'utf8');
+    expect(contents).to.match(/WARNING:.*\[spec\] APP_LOG answer=42 name="a b"/);
+  });
+
+  it('rate limits messages per category', async () => {
+    const logFilePath = path.join(app.getPath('temp'), 'test-log-file-' + uuid.v4());
+    const rc = await startRemoteControlApp(['--enable-logging', '--log-file=' + logFilePath]);
+    rc.remotely(() => {
+      const { app } = require('electron');
+      for (let i = 0; i < 150; i++) {
+        app.log('NOISY_LOG', { category: 'noisy' });
+      }
+      app.log('QUIET_LOG', { category: 'quiet' });
+      setTimeout(() => {
+        app.log('NOISY_LOG', { category: 'noisy' });
+        app.quit();
+      }, 1100);
+    });
+    await once(rc.process, 'exit');
+    const contents = await fs.readFile(logFilePath, 'utf8');
+    expect(contents.match(/NOISY_LOG/g)).to.have.lengthOf(101);
+    expect(contents).to.match(/QUIET_LOG/);
+    expect(contents).to.match(/\[50 messages from noisy suppressed\]/);
+  });
+
+  it('rotates the log file when --log-file-max-size is passed', async () => {
+    const logFilePath = path.join(app.getPath('temp'), 'test-log-file-' + uuid.v4());
+    const rc = await startRemoteControlApp(['--enable-logging', '--log-file=' + logFilePath, '--log-file-max-size=4096']);
+    rc.remotely(() => {
+      const { app } = require('electron');
+      for (let i = 0; i < 50; i++) {
+        app.log('x'.repeat(100), { category: `rotate-${i}` });
+      }
+      setTimeout(() => { app.quit(); }, 500);
+    });
+    await once(rc.process, 'exit');
+    const rotated = await fs.readFile(`${logFilePath}.1`, 'utf8');
+    expect(rotated).to.match(/x{100}/);
+  });
+
+  it('throws for invalid levels and field names', () => {
+    expect(() => app.log('test', { level: 'loud' as any })).to.throw(/Invalid log level/);
+    expect(() => app.log('test', { fields: { 'a b': 1 } })).to.throw(/Invalid log field name/);
+  });
+});
@@ -84,6 +84,7 @@ declare namespace NodeJS {
     realpath(path: string): string | false;
     copyFileOut(path: string): string | false;
     getFdAndValidateIntegrityLater(): number | -1;
+    getHeaderIntegrity(): AsarFileInfo['integrity'];
   }
 
   interface AsarBinding {
@@ -17,6 +17,7 @@ declare namespace Electron {
     setVersion(version: string): void;
     setDesktopName(name: string): void;
     setAppPath(path: string | null): void;
+    _log(level: string, category: string, message: string): void;
     _clientCertRequestPasswordHandler: ((params: ClientCertRequestParams) => Promise<string>) | null;
     on(event: '-client-certificate-request-password', listener: (event: Event<ClientCertRequestParams>, callback: (password: string) => void) => Promise<void>): this;
   }
@@ -101,6 +102,7 @@ declare namespace Electron {
     _send(internal: boolean, channel: string, args: any): boolean;
     _sendInternal(channel: string, ...args: any[]): void;
     _printToPDF(options: any): Promise<Buffer>;
+    _printToPDFFile(filePath: string, options: any): Promise<void>;
     _print(options: any, callback?: (success: boolean, failureReason: string) => void): void;
     _getPrintersAsync(): Promise<Electron.PrinterInfo[]>;
     _init(): void;
@@ -332,12 +334,14 @@ declare namespace ElectronInternal {
     readonly pid: (number) | (undefined);
     kill(): boolean;
     postMessage(message: any, transfer?: any[]): void;
+    createRingBuffer(capacity: number): any;
   }
 
   interface ParentPort extends NodeJS.EventEmitter {
     start(): void;
     pause(): void;
-    postMessage(message: any): void;
+    postMessage(message: any, transfer?: any[]): void;
+    createRingBuffer(capacity: number): any;
   }
 
   class WebViewElement extends HTMLElement {